@@ -28,6 +28,9 @@ using Parsimonious_Production_System::Production_System;
 using std::string;
 using std::clock_t; using std::clock;
 using std::endl;	using std::cerr;
+using std::map;
+using std::pair;	using std::make_pair;
+using std::size_t;
 
 const int Cognitive_processor::idle_step_limit = 1000;
 
@@ -53,6 +56,9 @@ void Cognitive_processor::initialize()
 //	cycle_number = 0;
 	idle_step_counter = 0;
 	advance_next_step = true;	
+	pending_updates.clear();
+	pending_update_positions.clear();
+	delayed_updates.clear();
 
 	// this empties all the data
 	ps.reset();
@@ -73,7 +79,11 @@ void Cognitive_processor::accept_event(const Start_event *)
 
 void Cognitive_processor::accept_event(const Stop_event *)
 {
+	// leave the memory showing the updates that have arrived
+	apply_updates();
 //	psychological_space.display_contents(Normal_out);
+	if(ps.get_profiling_enabled())
+		ps.display_profile();
 }
 
 void Cognitive_processor::accept_event(const Cognitive_event * event_ptr)
@@ -88,6 +98,8 @@ void Cognitive_processor::accept_event(const Cognitive_event * event_ptr)
 
 void Cognitive_processor::handle_event(const Cognitive_Cycle_event *)
 {
+	// bring the memory up to date with the updates that arrived since the last cycle
+	apply_updates();
 	// the step_end_time is one less than the start time of the next cycle
 	// to allow motor commands to start execution before the beginning of the next cycle
 	step_end_time = get_time() + cycle_time.get_long_value() - 1;
@@ -112,7 +124,10 @@ void Cognitive_processor::handle_event(const Cognitive_Cycle_event *)
 
 
 	if(advance_next_step) {
-		schedule_event(new Cognitive_Cycle_event(step_end_time + 1, this));
+		long next_cycle_time = step_end_time + 1;
+		if(!rule_fired)
+			next_cycle_time = skip_idle_cycles(next_cycle_time);
+		schedule_event(new Cognitive_Cycle_event(next_cycle_time, this));
 		}
 	
 	// decide that we have to pause the simulation here ...
@@ -120,6 +135,43 @@ void Cognitive_processor::handle_event(const Cognitive_Cycle_event *)
 		Coordinator::get_instance().pause();
 }
 
+/*
+If no rule fired and nothing is waiting to change working memory, every following cycle will
+also be idle until an update arrives. Updates arrive only from events or delayed updates, so
+the cycles before the next event or delayed update can be counted as idle without being run,
+and the next cycle event scheduled for the last cycle before that time. That cycle is run
+as usual, so its event and the ones after it are ordered exactly as before. Skipping stops at
+the end of the current run, so that the counts are correct whenever the simulation is paused,
+and where the idle step limit would halt the simulation. Cycles are not skipped if they would
+produce output.
+*/
+long Cognitive_processor::skip_idle_cycles(long next_cycle_time)
+{
+	if(!pending_updates.empty() || ps.memory_updated())
+		return next_cycle_time;
+	if((get_trace() && Trace_out) || ps.get_output_run_messages())
+		return next_cycle_time;
+	Coordinator& coordinator = Coordinator::get_instance();
+	long limit_time = coordinator.get_next_event_time();
+	if(!delayed_updates.empty() && delayed_updates.begin()->first.first < limit_time)
+		limit_time = delayed_updates.begin()->first.first;
+	if(coordinator.get_run_end_time() < limit_time)
+		limit_time = coordinator.get_run_end_time() + 1;
+	// the cycles at next_cycle_time + i * cycle_duration for i < n_skipped are before limit_time, 
+	// and so is the one that will be run
+	long cycle_duration = cycle_time.get_long_value();
+	long n_skipped = (limit_time - 1 - next_cycle_time) / cycle_duration;
+	// the cycle that starts with idle_step_counter over the limit must be run to halt
+	long n_allowed = idle_step_limit - idle_step_counter + 1;
+	if(n_skipped > n_allowed)
+		n_skipped = n_allowed;
+	if(n_skipped <= 0)
+		return next_cycle_time;
+	idle_step_counter += n_skipped;
+	ps.count_idle_cycles(n_skipped);
+	return next_cycle_time + n_skipped * cycle_duration;
+}
+
 void Cognitive_processor::handle_event(const Cognitive_Update_event * event_ptr)
 {
 	if(get_trace() && Trace_out)
@@ -128,10 +180,11 @@ void Cognitive_processor::handle_event(const Cognitive_Update_event * event_ptr)
 			<< " to " << event_ptr->new_value << endl;
 
 	
+	release_delayed_updates();
 	if(event_ptr->old_value != Nil_c)
-		ps.update_delete_clause(Clause(event_ptr->tag_name, event_ptr->object_name, event_ptr->property_name, event_ptr->old_value));
+		add_pending_update(Clause(event_ptr->tag_name, event_ptr->object_name, event_ptr->property_name, event_ptr->old_value), false);
 	if(event_ptr->new_value != Nil_c)
-		ps.update_add_clause(Clause(event_ptr->tag_name, event_ptr->object_name, event_ptr->property_name, event_ptr->new_value));
+		add_pending_update(Clause(event_ptr->tag_name, event_ptr->object_name, event_ptr->property_name, event_ptr->new_value), true);
 	
 }
 			
@@ -141,7 +194,8 @@ void Cognitive_processor::handle_event(const Cognitive_Add_Clause_event * event_
 	if(get_trace() && Trace_out)
 		Trace_out << processor_info() << "add clause: " << clause << endl; 
 
-	ps.update_add_clause(clause);
+	release_delayed_updates();
+	add_pending_update(clause, true);
 }
 
 void Cognitive_processor::handle_event(const Cognitive_Delete_Clause_event * event_ptr)
@@ -150,7 +204,8 @@ void Cognitive_processor::handle_event(const Cognitive_Delete_Clause_event * eve
 	if(get_trace() && Trace_out)
 		Trace_out << processor_info() << "delete clause: " << clause << endl; 
 
-	ps.update_delete_clause(clause);
+	release_delayed_updates();
+	add_pending_update(clause, false);
 }
 
 // direct call update inputs
@@ -161,10 +216,11 @@ void Cognitive_processor::update_object_property(const Symbol& type_name, const
 			<< " " << property_name << " from " << old_value
 			<< " to " << new_value << endl;
 
+	release_delayed_updates();
 	if(old_value != Nil_c)
-		ps.update_delete_clause(Clause(type_name, object_name, property_name, old_value));
+		add_pending_update(Clause(type_name, object_name, property_name, old_value), false);
 	if(new_value != Nil_c)
-		ps.update_add_clause(Clause(type_name, object_name, property_name, new_value));
+		add_pending_update(Clause(type_name, object_name, property_name, new_value), true);
 }
 
 void Cognitive_processor::add_clause(const Clause& clause)
@@ -172,7 +228,8 @@ void Cognitive_processor::add_clause(const Clause& clause)
 	if(get_trace() && Trace_out)
 		Trace_out << processor_info() << "add clause: " << clause << endl; 
 
-	ps.update_add_clause(clause);
+	release_delayed_updates();
+	add_pending_update(clause, true);
 }
 
 void Cognitive_processor::delete_clause(const Clause& clause)
@@ -180,6 +237,87 @@ void Cognitive_processor::delete_clause(const Clause& clause)
 	if(get_trace() && Trace_out)
 		Trace_out << processor_info() << "delete clause: " << clause << endl; 
 
-	ps.update_delete_clause(clause);
+	release_delayed_updates();
+	add_pending_update(clause, false);
+}
+
+// delayed update inputs
+void Cognitive_processor::schedule_object_property_update(long time, const Symbol& type_name, const Symbol& object_name, const Symbol& property_name, const Symbol& old_value, const Symbol& new_value)
+{
+	Assert(time >= get_time());
+	if(old_value != Nil_c)
+		schedule_update(time, Clause(type_name, object_name, property_name, old_value), false);
+	if(new_value != Nil_c)
+		schedule_update(time, Clause(type_name, object_name, property_name, new_value), true);
+}
+
+void Cognitive_processor::schedule_add_clause(long time, const Clause& clause)
+{
+	Assert(time >= get_time());
+	schedule_update(time, clause, true);
+}
+
+void Cognitive_processor::schedule_delete_clause(long time, const Clause& clause)
+{
+	Assert(time >= get_time());
+	schedule_update(time, clause, false);
+}
+
+// The update is filed under the time and a serial number taken from the same sequence as the
+// events' serial numbers, so it will be released in the order an event scheduled now would be delivered.
+void Cognitive_processor::schedule_update(long time, const Clause& clause, bool add)
+{
+	delayed_updates.insert(make_pair(make_pair(time, Event::reserve_serial_number()), Clause_update(clause, add)));
+}
+
+// move the delayed updates whose events would have been delivered before the current one into the pending updates
+void Cognitive_processor::release_delayed_updates()
+{
+	pair<long, long> current_position(get_time(), Coordinator::get_current_serial_number());
+	while(!delayed_updates.empty() && delayed_updates.begin()->first < current_position) {
+		const Clause_update& update = delayed_updates.begin()->second;
+		if(get_trace() && Trace_out)
+			Trace_out << processor_info() << ((update.add) ? "add clause: " : "delete clause: ") << update.clause 
+				<< " scheduled for " << delayed_updates.begin()->first.first << endl; 
+		add_pending_update(update.clause, update.add);
+		delayed_updates.erase(delayed_updates.begin());
+		}
+}
+
+// Working memory is a set of clauses, so an update that repeats the latest one for the same clause
+// has no effect and is dropped, and a delete makes an earlier add of the clause irrelevant.
+// A delete followed by an add is kept as is, because the add places the clause after the others.
+void Cognitive_processor::add_pending_update(const Clause& clause, bool add)
+{
+	map<Clause, size_t>::iterator it = pending_update_positions.find(clause);
+	if(it == pending_update_positions.end()) {
+		pending_update_positions.insert(make_pair(clause, pending_updates.size()));
+		}
+	else {
+		Clause_update& previous_update = pending_updates[it->second];
+		if(previous_update.add == add)
+			return;
+		if(!add)
+			previous_update.cancelled = true;
+		it->second = pending_updates.size();
+		}
+	pending_updates.push_back(Clause_update(clause, add));
+}
+
+// apply the updates that have arrived to the production system memory
+void Cognitive_processor::apply_updates()
+{
+	release_delayed_updates();
+	for(size_t i = 0; i < pending_updates.size(); i++) {
+		const Clause_update& update = pending_updates[i];
+		if(update.cancelled)
+			continue;
+		if(update.add)
+			ps.update_add_clause(update.clause);
+		else
+			ps.update_delete_clause(update.clause);
+		}
+	pending_updates.clear();
+	pending_update_positions.clear();
 }
 
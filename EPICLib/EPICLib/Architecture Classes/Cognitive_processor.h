@@ -8,6 +8,10 @@
 #include "Parameter.h"
 
 //#include <string>
+#include <map>
+#include <vector>
+#include <utility>
+#include <cstddef>
 
 //class Clause;
 
@@ -22,6 +26,14 @@
 // If the old value is Symbol(), nothing is discarded - assumed nothing there already.
 // If the new_value is Symbol(), the new value is not stored (i.e. erase the old value).
 
+// Updates are not applied to the production system as they arrive. Instead they are collected
+// in arrival order and applied together at the start of the next cycle, which is the first point
+// at which the production rules can see them. Because working memory is a set, a repeated add or
+// delete of the same clause is dropped, and an add followed by a delete has the effect of just the delete.
+// Updates scheduled for a later time are held by the cognitive processor rather than put in
+// the Coordinator's event queue; they are collected in the same order as Cognitive_Update_events
+// scheduled at the same point would have been delivered.
+
 
 
 // This class defines the common interface between a cognitive processor and the rest of the
@@ -63,6 +75,11 @@ public:
 		const Symbol& old_value, const Symbol& new_value);
 	void add_clause(const Clause& clause);
 	void delete_clause(const Clause& clause);
+	// delayed inputs - take effect at the supplied time, which must not be earlier than the current time
+	void schedule_object_property_update(long time, const Symbol& type_name, const Symbol& object_name, const Symbol& property_name, 
+		const Symbol& old_value, const Symbol& new_value);
+	void schedule_add_clause(long time, const Clause& clause);
+	void schedule_delete_clause(long time, const Clause& clause);
 	
 	// services to the rest of the system
 	Geometry_Utilities::Point get_named_location(const Symbol& name, bool& found) const
@@ -71,7 +88,7 @@ public:
 		{return ps.get_parameter_specifications();}
     
     void display_memory_contents()
-        {ps.display_memory_contents();}
+        {apply_updates(); ps.display_memory_contents();}
 		
 	// functions to get/set output flags in Production System
 	bool get_output_compiler_messages() const
@@ -98,6 +115,12 @@ public:
 		{return ps.get_output_run_memory_contents();}
 	void set_output_run_memory_contents(bool flag)
 		{ps.set_output_run_memory_contents(flag);}
+
+	// if enabled, the production system profile is output at the end of the run
+	bool get_profiling_enabled() const
+		{return ps.get_profiling_enabled();}
+	void set_profiling_enabled(bool flag)
+		{ps.set_profiling_enabled(flag);}
 		
 	long get_step_end_time() const
 		{return step_end_time;}
@@ -163,6 +186,28 @@ private:
 	bool ready_to_run;	// true if have successfully compiled a rule set
 	Parsimonious_Production_System::Production_System ps;
 
+	// a change to working memory that has not been applied yet
+	struct Clause_update {
+		Clause_update(const Clause& clause_, bool add_) :
+			clause(clause_), add(add_), cancelled(false)
+			{}
+		Clause clause;
+		bool add;		// false for a delete
+		bool cancelled;	// superseded by a later delete of the same clause
+	};
+	std::vector<Clause_update> pending_updates;	// in arrival order
+	std::map<Clause, std::size_t> pending_update_positions;	// position of the latest pending update of each clause
+	// updates for later times, ordered by time and then by the serial number reserved when scheduled
+	typedef std::multimap<std::pair<long, long>, Clause_update> Delayed_updates_t;
+	Delayed_updates_t delayed_updates;
+
+	void add_pending_update(const Clause& clause, bool add);
+	void schedule_update(long time, const Clause& clause, bool add);
+	void release_delayed_updates();
+	void apply_updates();
+	// count the idle cycles that can be skipped and return the time of the next cycle to run
+	long skip_idle_cycles(long next_cycle_time);
+
 };
 
 #endif
@@ -38,7 +38,6 @@ using std::endl;
 using std::istringstream;
 using std::map;	using std::make_pair;
 using std::numeric_limits;
-using std::remove_copy;
 using std::min_element;
 
 
@@ -54,7 +53,6 @@ Unknown_perceptual_property(Processor * proc_ptr, const Symbol& propname)
 };
 
 const Symbol Category_c ("Category");
-const int max_n_sounds_present = 4;
 
 const Symbol Acoustic_status_c("Acoustic_status");
 const Symbol Masked_c("Masked");
@@ -563,7 +561,6 @@ void Auditory_perceptual_processor::make_new_speech_start_f(const Speech_word& w
 	// and stream tracking mechanism
 	int n_sounds_present = int(sounds_present.size());
 	if(n_sounds_present > 1) {
-		Assert(n_sounds_present <= max_n_sounds_present);
 
         const double effective_snr_loudness_difference_weight = effective_snr_loudness_weight.get_double_value();
         const double effective_snr_pitch_difference_weight = effective_snr_pitch_weight.get_double_value();
@@ -575,11 +572,6 @@ void Auditory_perceptual_processor::make_new_speech_start_f(const Speech_word& w
         double theta = stream_theta.get_double_value();
         Symbol this_name = word.name;
         
-        // get a list of the other sounds present - this is a list of their names
-        Symbol_list_t other_sounds_present;
-        remove_copy(sounds_present.begin(), sounds_present.end(), back_inserter(other_sounds_present), this_name);
-        Assert(other_sounds_present.size() <= n_sounds_present - 1);
-
         // collect the relevant properties from the object in sensory store
         shared_ptr<Auditory_sound> this_sound_ptr = sensory_store_ptr->get_sound_ptr(word.name);
 		const Symbol& this_content = this_sound_ptr->get_content();
@@ -605,8 +597,10 @@ void Auditory_perceptual_processor::make_new_speech_start_f(const Speech_word& w
 		location_stats.reset();
 //        vector<double> pitch_differences;
 //        vector<double> azimuth_differences;
-		for(Symbol_list_t::iterator it = other_sounds_present.begin(); it != other_sounds_present.end(); ++it) {
-			shared_ptr<Auditory_sound> other_sound = sensory_store_ptr->get_sound_ptr(*it);
+		// the other sounds present are the non-fading sounds other than this one
+		for(const shared_ptr<Auditory_sound>& other_sound : sensory_store_ptr->get_sounds()) {
+			if(other_sound->get_fading() || other_sound->get_name() == this_name)
+				continue;
 			total_masking_power += pow(10., other_sound->get_loudness() / 10.);
 			total_right_masking_power += pow(10., other_sound->get_level_right() / 10.);
 			total_left_masking_power += pow(10., other_sound->get_level_left() / 10.);
@@ -663,10 +657,10 @@ void Auditory_perceptual_processor::make_new_speech_start_f(const Speech_word& w
         // but we have to process them one at a time.
         // So we have to check on whether we have assigned words to the sreams yet. 
 		// determine if all words are unassigned
-        // this would be faster if we had a container of sound_ptrs instead.
 		bool words_unassigned = true;
-		for(Symbol_list_t::iterator it = sounds_present.begin(); it != sounds_present.end(); ++it) {
-			shared_ptr<Auditory_sound> sound_ptr = sensory_store_ptr->get_sound_ptr(*it);
+		for(const shared_ptr<Auditory_sound>& sound_ptr : sensory_store_ptr->get_sounds()) {
+			if(sound_ptr->get_fading())
+				continue;
 			// all sounds must be unassigned for words_unassigned to end up as true
 			words_unassigned = words_unassigned && (sound_ptr->get_property_value(Stream_assignment_c) == Nil_c);
 			}
@@ -676,8 +670,10 @@ void Auditory_perceptual_processor::make_new_speech_start_f(const Speech_word& w
 		if(words_unassigned) {
             // give the stream tracker the sounds
             stream_tracker_ptr->clear_sounds();
-            for(Symbol_list_t::iterator it = sounds_present.begin(); it != sounds_present.end(); ++it)
-                stream_tracker_ptr->add_sound(sensory_store_ptr->get_sound_ptr(*it));
+            for(const shared_ptr<Auditory_sound>& sound_ptr : sensory_store_ptr->get_sounds()) {
+                if(!sound_ptr->get_fading())
+                    stream_tracker_ptr->add_sound(sound_ptr);
+                }
  
             // now ready to do stream assignment work - have we started the streams yet?
             // note that long delay will result in streams being deleted, so "resets" automatically
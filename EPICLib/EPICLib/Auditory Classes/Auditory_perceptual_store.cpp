@@ -160,9 +160,9 @@ void Auditory_perceptual_store::handle_event(const Auditory_Stream_Set_Location_
 		get_human_ptr()->get_Cognitive_processor_ptr()->
 			update_object_property(Auditory_c, event_ptr->stream_name, Location_c, Nil_c, Change_c);
 		// schedule for later delivery
-		schedule_event(new Cognitive_Update_event(
-			get_time() + change_decay_time.get_long_value(), get_human_ptr()->get_Cognitive_processor_ptr(),
-			Auditory_c, event_ptr->stream_name, Location_c, Change_c, Nil_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time() + change_decay_time.get_long_value(),
+			Auditory_c, event_ptr->stream_name, Location_c, Change_c, Nil_c);
 		}
 }
 
@@ -175,9 +175,9 @@ void Auditory_perceptual_store::handle_event(const Auditory_Stream_Set_Pitch_eve
 		get_human_ptr()->get_Cognitive_processor_ptr()->
 			update_object_property(Auditory_c, event_ptr->stream_name, Pitch_c, Nil_c, Change_c);
 		// schedule for later delivery
-		schedule_event(new Cognitive_Update_event(
-			get_time() + change_decay_time.get_long_value(), get_human_ptr()->get_Cognitive_processor_ptr(),
-			Auditory_c, event_ptr->stream_name, Pitch_c, Change_c, Nil_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time() + change_decay_time.get_long_value(),
+			Auditory_c, event_ptr->stream_name, Pitch_c, Change_c, Nil_c);
 		}
 }
 
@@ -190,9 +190,9 @@ void Auditory_perceptual_store::handle_event(const Auditory_Stream_Set_Loudness_
 		get_human_ptr()->get_Cognitive_processor_ptr()->
 			update_object_property(Auditory_c, event_ptr->stream_name, Loudness_c, Nil_c, Change_c);
 		// schedule for later delivery
-		schedule_event(new Cognitive_Update_event(
-			get_time() + change_decay_time.get_long_value(), get_human_ptr()->get_Cognitive_processor_ptr(),
-			Auditory_c, event_ptr->stream_name, Loudness_c, Change_c, Nil_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time() + change_decay_time.get_long_value(),
+			Auditory_c, event_ptr->stream_name, Loudness_c, Change_c, Nil_c);
 		}
 }
 
@@ -206,9 +206,9 @@ void Auditory_perceptual_store::handle_event(const Auditory_Stream_Set_Size_even
 			update_object_property(Auditory_c, event_ptr->stream_name, Size_c, Nil_c, Change_c);
 
 		// schedule for later delivery
-		schedule_event(new Cognitive_Update_event(
-			get_time() + change_decay_time.get_long_value(), get_human_ptr()->get_Cognitive_processor_ptr(),
-			Auditory_c, event_ptr->stream_name, Size_c, Change_c, Nil_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time() + change_decay_time.get_long_value(),
+			Auditory_c, event_ptr->stream_name, Size_c, Change_c, Nil_c);
 		}
 }
 
@@ -25,6 +25,7 @@ Both Auditory_store and Auditory_stream are base classes.
 #include "Symbol.h"
 #include "OPV_Containers.h"
 #include "Geometry.h"
+#include "Utility_templates.h"
 //#include "Output_tee.h"
 
 namespace GU = Geometry_Utilities;
@@ -313,6 +314,12 @@ public:
 	// return a list of pointers to all the current objects
 	typedef std::list<std::shared_ptr<Auditory_stream> > Stream_ptr_list_t;
 	Stream_ptr_list_t get_stream_ptr_list() const;
+	// iterate over pointers to all the current streams, in name order, without copying them;
+	// streams must not be added or erased while the range is in use
+	typedef std::map<Symbol, std::shared_ptr<Auditory_stream> > Stream_container_t;
+	typedef Map_value_range<Stream_container_t> Stream_range_t;
+	Stream_range_t get_streams() const
+		{return Stream_range_t(streams);}
 
 	// sounds are accessed via the obj_name; throw exception if not already present
 	std::shared_ptr<Auditory_sound> get_sound_ptr(const Symbol& obj_name) const;
@@ -323,6 +330,12 @@ public:
 	// return a list of pointers to all the current objects
 	typedef std::list<std::shared_ptr<Auditory_sound> > Sound_ptr_list_t;
 	Sound_ptr_list_t get_sound_ptr_list() const;
+	// iterate over pointers to all the current sounds, in name order, without copying them;
+	// sounds must not be added or erased while the range is in use
+	typedef std::map<Symbol, std::shared_ptr<Auditory_sound> > Sound_container_t;
+	typedef Map_value_range<Sound_container_t> Sound_range_t;
+	Sound_range_t get_sounds() const
+		{return Sound_range_t(sounds);}
 
 	// see if the object is present in the store and is not fading; return true if so, false if not - no exception thrown
 	bool is_not_fading_sound_present(const Symbol& obj_name) const;
@@ -337,9 +350,7 @@ public:
 protected:	
 	// state
 	bool changed;	// true if data was updated due to input. // not clear what this is for - 6/17/15
-	typedef std::map<Symbol, std::shared_ptr<Auditory_stream> > Stream_container_t;
 	Stream_container_t streams;	// the stream storage
-	typedef std::map<Symbol, std::shared_ptr<Auditory_sound> > Sound_container_t;
 	Sound_container_t sounds;	// the sounds storage
 	
 	// helper functions
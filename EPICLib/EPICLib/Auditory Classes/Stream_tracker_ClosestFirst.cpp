@@ -45,6 +45,7 @@ void Stream_tracker_ClosestFirst::assign_sounds_to_streams()
     double distances[max_n_sounds_present][max_n_sounds_present]; // first index is sound index, second is stream index
     // n_sounds_present should also be the number of streams present
     Assert(sounds.size() == streams.size());
+    Assert(sounds.size() <= max_n_sounds_present);
     for(int sound_index = 0; sound_index < sounds.size(); sound_index++)
         for(int stream_index = 0; stream_index < sounds.size(); stream_index++) {
             double distance = get_distance(
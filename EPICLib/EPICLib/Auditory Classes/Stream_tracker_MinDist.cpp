@@ -47,30 +47,19 @@ void Stream_tracker_MinDist::assign_sounds_to_streams()
     shuffle(sounds.begin(), sounds.end(), get_Random_engine());
     // calculate simple distance of each sound to each stream in a 2-d array
 //    const int max_n_sounds_present = 4;
-    // we will find the minimum total distance assignment of sounds to streams by
-    // generating all permutations of sound-to-stream assignment,
-    // and which one produces the minimum total.
+    // we will find the minimum total distance assignment of sounds to streams
+    // with the Hungarian algorithm instead of trying every permutation.
     
-    // the subscript of this vector represents the stream index;
+    // the subscript of the assignment vector represents the stream index;
     // the values in a cell represent the sound assigned to that stream.
-    // start with the cells containing the sound indicies in sorted order.
     Assert(sounds.size() == streams.size());
-    vector<int> assignments;
-    for(int sound_index = 0; sound_index < sounds.size(); sound_index++)
-        assignments.push_back(sound_index);
-    Assert(assignments.size() == streams.size());
-    // get the total distance of the starting arrangement, and save that arrangement
-    double min_total_dist = get_total_distance(assignments);
-    vector<int> min_total_distance_assignment(assignments);
-    // this loop continues until the next_permutation is the same as the starting in-order assignment
-    while(next_permutation(assignments.begin(), assignments.end())) {
-        double total_dist = get_total_distance(assignments);
-        if(total_dist < min_total_dist) {
-            min_total_dist = total_dist;
-            min_total_distance_assignment = assignments;
-            }
-        }
-    // at this point, min_total_dist and min_total_distance_assignments should have the final minimum values
+    vector<vector<double>> distances(streams.size(), vector<double>(sounds.size()));
+    for(int stream_index = 0; stream_index < streams.size(); stream_index++)
+        for(int sound_index = 0; sound_index < sounds.size(); sound_index++)
+            distances[stream_index][sound_index] = get_distance(
+                sounds[sound_index]->get_pitch(), sounds[sound_index]->get_loudness(),
+                streams[stream_index]);
+    vector<int> min_total_distance_assignment = find_min_total_cost_assignment(distances);
     // go through the final assignment and assign the sounds to the corresponding streams
     for(int stream_index = 0; stream_index < min_total_distance_assignment.size(); stream_index++) {
         int sound_index = min_total_distance_assignment[stream_index];
@@ -112,21 +101,6 @@ void Stream_tracker_MinDist::assign_sounds_to_streams()
 */
 }
 
-// the subscript of this vector represents the stream index;
-// the values in a cell represent the sound assigned to that stream.
-double Stream_tracker_MinDist::get_total_distance(vector<int> assignments) const
-{
-    double total = 0;
-    for(int stream_index = 0; stream_index < assignments.size(); stream_index++) {
-        int sound_index = assignments[stream_index];
-        total += get_distance(
-                sounds[sound_index]->get_pitch(), sounds[sound_index]->get_loudness(),
-                streams[stream_index]);
-        }
-    return total;
-}
-
-
 // get distance of supplied sound from specified stream
 double Stream_tracker_MinDist::get_distance(double pitch, double loudness, std::shared_ptr<Stream_base> stream) const
 {
@@ -19,7 +19,6 @@ public:
     
 private:
 	double lambda;
-    double get_total_distance(std::vector<int> assignments) const;
     // calculating distances between sounds and stream values
 	double get_distance(double pitch, double loudness, std::shared_ptr<Stream_base> stream) const;
 	double get_distance(double pitch1, double loudness1, double pitch2, double loudness2) const;
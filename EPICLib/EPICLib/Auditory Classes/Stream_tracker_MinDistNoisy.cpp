@@ -22,7 +22,6 @@
 using std::vector;
 using std::endl;
 using std::shuffle;
-using std::next_permutation;
 
 const Symbol Stream_assignment_c("Stream_assignment");
 
@@ -66,38 +65,34 @@ void Stream_tracker_MinDistNoisy::assign_sounds_to_streams()
     shuffle(sounds.begin(), sounds.end(), get_Random_engine());
     // calculate simple distance of each sound to each stream in a 2-d array
 //    const int max_n_sounds_present = 4;
-    // we will find the minimum total distance assignment of sounds to streams by
-    // generating all permutations of sound-to-stream assignment,
-    // and which one produces the minimum total.
+    // we will find the minimum total distance assignment of sounds to streams,
+    // and the maximum total distance over all assignments, with the Hungarian algorithm
+    // instead of trying every permutation; the maximum is the minimum of the negated distances.
     
-    // the subscript of this vector represents the stream index;
+    // the subscript of the assignment vectors represents the stream index;
     // the values in a cell represent the sound assigned to that stream.
-    // start with the cells containing the sound indicies in sorted order.
     Assert(sounds.size() == streams.size());
-    vector<int> assignments;
-    for(int sound_index = 0; sound_index < sounds.size(); sound_index++)
-        assignments.push_back(sound_index);
-    Assert(assignments.size() == streams.size());
-    // get the total distance of the starting arrangement, and save that arrangement
-    double min_total_dist = get_total_distance(assignments);
-    // we will be tracking the maximum distance found as well
-    double max_total_dist = get_total_distance(assignments);
-    vector<int> min_total_distance_assignment(assignments);
-    // this loop continues until the next_permutation is the same as the starting in-order assignment
-    while(next_permutation(assignments.begin(), assignments.end())) {
-        double total_dist = get_total_distance(assignments);
-        if(total_dist > max_total_dist) {
-            max_total_dist = total_dist;
-            }
-        if(total_dist < min_total_dist) {
-            min_total_dist = total_dist;
-            min_total_distance_assignment = assignments;
+    vector<vector<double>> distances(streams.size(), vector<double>(sounds.size()));
+    vector<vector<double>> negated_distances(streams.size(), vector<double>(sounds.size()));
+    for(int stream_index = 0; stream_index < streams.size(); stream_index++)
+        for(int sound_index = 0; sound_index < sounds.size(); sound_index++) {
+            double distance = get_distance(
+                sounds[sound_index]->get_pitch(), sounds[sound_index]->get_loudness(),
+                sounds[sound_index]->get_location().x, // should be the azimuth
+                streams[stream_index]);
+            distances[stream_index][sound_index] = distance;
+            negated_distances[stream_index][sound_index] = -distance;
             }
-        }
+    vector<int> min_total_distance_assignment = find_min_total_cost_assignment(distances);
+    double min_total_dist = get_total_distance(min_total_distance_assignment);
+    double max_total_dist = get_total_distance(find_min_total_cost_assignment(negated_distances));
     // at this point, min_total_dist and min_total_distance_assignments should have the final minimum values
     // and max_total_dist will have the maximum value obtained in the assignments
     // does the difference between max_total_dist and min_total_dist exceed the threshold?
     // if not, then pick from a random shuffle of the assignment
+    // the two totals can differ by rounding when every assignment has the same total distance
+    if(max_total_dist < min_total_dist)
+        max_total_dist = min_total_dist;
     Assert(max_total_dist >= min_total_dist);
     if((max_total_dist - min_total_dist) <= theta) {
 		// for two streams, interchange the two cells
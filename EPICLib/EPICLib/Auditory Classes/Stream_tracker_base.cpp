@@ -22,6 +22,8 @@
 using std::find_if;
 using std::shuffle;
 using std::endl;
+using std::vector;
+using std::numeric_limits;
 
 const Symbol Stream_assignment_c("Stream_assignment");
 
@@ -101,3 +103,65 @@ void Stream_tracker_base::delete_stream(const Symbol& stream_name)
 	streams.erase(it);
 }
 
+/* The Hungarian algorithm (Kuhn-Munkres with row and column potentials), which takes O(n^3)
+instead of the O(n! n) of trying every permutation. Each row (stream) is added in turn, and
+a shortest augmenting path to a free column (sound) is found using the reduced costs,
+adjusting the potentials so that the reduced costs stay non-negative. The arrays are 1-based;
+column 0 is a sentinel for the row being added.
+*/
+vector<int> Stream_tracker_base::find_min_total_cost_assignment(const vector<vector<double>>& costs)
+{
+	const int n = int(costs.size());
+	const double inf = numeric_limits<double>::infinity();
+	vector<double> row_potential(n + 1, 0.), column_potential(n + 1, 0.);
+	vector<int> column_row(n + 1, 0);	// the row assigned to each column, 0 if none
+	vector<int> previous_column(n + 1, 0);	// the augmenting path back to the sentinel
+	for(int row = 1; row <= n; row++) {
+		Assert(int(costs[row - 1].size()) == n);
+		column_row[0] = row;
+		int current_column = 0;
+		vector<double> min_reduced_cost(n + 1, inf);
+		vector<bool> used(n + 1, false);
+		// extend the path from the current column until it reaches a free column
+		do {
+			used[current_column] = true;
+			int current_row = column_row[current_column];
+			int next_column = 0;
+			double delta = inf;
+			for(int column = 1; column <= n; column++) {
+				if(used[column])
+					continue;
+				double reduced_cost = costs[current_row - 1][column - 1] - row_potential[current_row] - column_potential[column];
+				if(reduced_cost < min_reduced_cost[column]) {
+					min_reduced_cost[column] = reduced_cost;
+					previous_column[column] = current_column;
+					}
+				if(min_reduced_cost[column] < delta) {
+					delta = min_reduced_cost[column];
+					next_column = column;
+					}
+				}
+			Assert(next_column != 0);	// only if a cost is not a finite number
+			for(int column = 0; column <= n; column++) {
+				if(used[column]) {
+					row_potential[column_row[column]] += delta;
+					column_potential[column] -= delta;
+					}
+				else
+					min_reduced_cost[column] -= delta;
+				}
+			current_column = next_column;
+			} while(column_row[current_column] != 0);
+		// reassign the columns along the path
+		do {
+			int column = previous_column[current_column];
+			column_row[current_column] = column_row[column];
+			current_column = column;
+			} while(current_column != 0);
+		}
+
+	vector<int> assignment(n);
+	for(int column = 1; column <= n; column++)
+		assignment[column_row[column] - 1] = column - 1;
+	return assignment;
+}
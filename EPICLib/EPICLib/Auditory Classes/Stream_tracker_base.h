@@ -59,6 +59,9 @@ protected:
     // services for derived classes
     const std::string& get_stream_type_name()
         {return stream_type_name;}   // for use in Stream_type_factory;
+    // given costs[stream_index][sound_index] for a square matrix, return the assignment with the minimum total cost;
+    // the subscript of the result is the stream index, the value is the sound index assigned to that stream.
+    static std::vector<int> find_min_total_cost_assignment(const std::vector<std::vector<double>>& costs);
     
 private:
      std::string stream_type_name;   // for use in Stream_type_factory;
@@ -23,22 +23,22 @@ using std::dynamic_pointer_cast;
 // the stored location and size are in pixel units
 
 // the following values are inputs from the physical situation - specific values from Marshall task setup
-double Widget::screen_hor_pixel_size = 1024;
-double Widget::screen_vert_pixel_size = 768;
-double Widget::screen_hor_unit_size = 14.22;
-double Widget::screen_distance_units = 24.4;	// e.g. inches between eyes and screen
-GU::Size Widget::screen_pixels_per_character = GU::Size(5., 7.);	// a reasonable default
+thread_local double Widget::screen_hor_pixel_size = 1024;
+thread_local double Widget::screen_vert_pixel_size = 768;
+thread_local double Widget::screen_hor_unit_size = 14.22;
+thread_local double Widget::screen_distance_units = 24.4;	// e.g. inches between eyes and screen
+thread_local GU::Size Widget::screen_pixels_per_character = GU::Size(5., 7.);	// a reasonable default
 // the screen pixel visual orgin is the pixel coordinates for the straight ahead (0, 0) dva origin
 // assumes center of screen is at visual origin
-GU::Point Widget::screen_pixel_visual_origin = 
+thread_local GU::Point Widget::screen_pixel_visual_origin = 
 	GU::Point(screen_hor_pixel_size / 2., screen_vert_pixel_size / 2.);
 
 // the following values will be recomputed if any of the input values are changed
-double Widget::screen_pixels_per_unit = 72;
-double Widget::degrees_va_per_pixel = .0321;
-double Widget::pixels_per_degrees_va = 31.15;
+thread_local double Widget::screen_pixels_per_unit = 72;
+thread_local double Widget::degrees_va_per_pixel = .0321;
+thread_local double Widget::pixels_per_degrees_va = 31.15;
 
-bool Widget::add_widget_type_property = false;
+thread_local bool Widget::add_widget_type_property = false;
 
 Widget::Widget(Device_base * device_ptr_, const Symbol& widget_name_, GU::Point location_, GU::Size size_) : 
 	device_ptr(device_ptr_), widget_name(widget_name_), location(location_), size(size_), presented(NEVER_PRESENTED)
@@ -110,25 +110,27 @@ private:
 	Presented_t presented;
 	std::shared_ptr<Container_widget> container_ptr;	// pointer to a container widget, if any
 	
-	static bool add_widget_type_property;			// if true, the widget type property is included
+	static thread_local bool add_widget_type_property;	// if true, the widget type property is included
 
 	// widgets work in pixel coordinates, but present things in visual angle coordinates
 	// upper left corner of display is pixel (0, 0)
+	// these settings are per thread, so that devices running in different threads, as in a
+	// Model_batch_runner, each have their own; a new thread starts with the default values
 
 	// the following values are inputs from the physical situation
-	static double screen_hor_pixel_size;
-	static double screen_vert_pixel_size;
-	static double screen_hor_unit_size;
-	static double screen_distance_units;	// e.g. inches between eyes and screen
-	static GU::Size screen_pixels_per_character;
+	static thread_local double screen_hor_pixel_size;
+	static thread_local double screen_vert_pixel_size;
+	static thread_local double screen_hor_unit_size;
+	static thread_local double screen_distance_units;	// e.g. inches between eyes and screen
+	static thread_local GU::Size screen_pixels_per_character;
 	// the screen pixel visual orgin is the pixel coordinates for the straight ahead (0, 0) dva origin
 	// assumes center of screen is at visual origin
-	static GU::Point screen_pixel_visual_origin;
+	static thread_local GU::Point screen_pixel_visual_origin;
 
 	// the following values will be recomputed if any of the input values are changed
-	static double screen_pixels_per_unit;	// e.g. pixels per inch
-	static double degrees_va_per_pixel;
-	static double pixels_per_degrees_va;
+	static thread_local double screen_pixels_per_unit;	// e.g. pixels per inch
+	static thread_local double degrees_va_per_pixel;
+	static thread_local double pixels_per_degrees_va;
 	
 	static void compute_visual_constants();
 };
@@ -8,29 +8,46 @@
 
 #include <string>
 #include <list>
-#include <queue>
 #include <algorithm>
 #include <iostream>
+#include <fstream>
 #include <climits>
+#include <chrono>
 //#include <typeinfo>
 
 
 using std::string;
 using std::list;
-using std::priority_queue;	using std::find;
+using std::find;
 using std::cout;	using std::endl;	using std::cerr;
 using std::time_t;	using std::clock_t;	using std::time;	using std::clock;	using std::difftime;
+using std::ofstream;
+using std::chrono::steady_clock;	using std::chrono::duration;
 
-long Coordinator::current_time = 0;
+thread_local long Coordinator::current_time = 0;
+thread_local long Coordinator::current_serial_number = -1;
+thread_local Coordinator * Coordinator::Coordinator_ptr = 0;
 
-Coordinator::Coordinator() : state(UNREADY)
+Coordinator::Coordinator() : state(UNREADY), run_end_time(0), dispatch_statistics_enabled(false)
 {}
 
-// A Meyers singleton 
+// One Coordinator per thread. Like Symbol_memory, this is not a Meyers singleton
+// because processors might get destroyed during thread or static destruction 
+// after the Coordinator would have been destructed.
 Coordinator & Coordinator::get_instance()
 {
-	static Coordinator the_coordinator;
-	return the_coordinator;
+	if(!Coordinator_ptr)
+		Coordinator_ptr = new Coordinator;
+	return *Coordinator_ptr;
+}
+
+void Coordinator::release_thread_instance()
+{
+	if(!Coordinator_ptr)
+		return;
+	Coordinator_ptr->delete_queued_events();
+	delete Coordinator_ptr;
+	Coordinator_ptr = 0;
 }
 
 
@@ -39,15 +56,11 @@ Coordinator & Coordinator::get_instance()
 void Coordinator::initialize()
 {
 	current_time = 0;
+	current_serial_number = -1;
 
-	int counter = 0;
-	while(!event_queue.empty()) {
-		const Event * event_ptr = event_queue.top();
-		// we need to delete the event
-		delete event_ptr;
-		event_queue.pop();
-		counter++;
-		}
+	int counter = delete_queued_events();
+	event_queue.reset(current_time);
+	dispatch_statistics.clear();
 
 	if(Normal_out && counter > 0)
 		Normal_out << "Event queue had " << counter << " left-over events" << endl;
@@ -101,6 +114,7 @@ void Coordinator::run_for(long run_duration)
 	
 	long time_out_time = run_duration + current_time;
 	Assert(time_out_time > current_time);	// should never be called with run_duration of 0
+	run_end_time = time_out_time;
 
 	const Event * event_ptr; Processor * proc_ptr; 
 
@@ -116,11 +130,20 @@ void Coordinator::run_for(long run_duration)
 			break;
 			}
 
+		if(dispatch_statistics_enabled)
+			dispatch_statistics.note_queue_depth(event_queue.size());
 		event_queue.pop();
 		// the current time is now that of the event to be sent
 		current_time = event_ptr->get_time();
+		current_serial_number = event_ptr->get_serial_number();
 		proc_ptr = event_ptr->get_destination();
-		event_ptr->send_self(proc_ptr);
+		if(dispatch_statistics_enabled) {
+			steady_clock::time_point start = steady_clock::now();
+			event_ptr->send_self(proc_ptr);
+			dispatch_statistics.record(event_ptr, proc_ptr, duration<double>(steady_clock::now() - start).count());
+			}
+		else
+			event_ptr->send_self(proc_ptr);
 		
 		//done with this event - must destroy it here!		
 		delete event_ptr;
@@ -172,6 +195,19 @@ void Coordinator::add_processor(Processor * p)
 	processor_list.push_back(p);
 }
 
+int Coordinator::delete_queued_events()
+{
+	int counter = 0;
+	while(!event_queue.empty()) {
+		const Event * event_ptr = event_queue.top();
+		// we need to delete the event
+		delete event_ptr;
+		event_queue.pop();
+		counter++;
+		}
+	return counter;
+}
+
 void Coordinator::remove_processor(Processor * p)
 {
 	// should be unique
@@ -197,6 +233,13 @@ void Coordinator::call_with_event(Event& msg)
 	event_ptr->send_self(proc_ptr);
 }
 
+long Coordinator::get_next_event_time()
+{
+	if(event_queue.empty())
+		return LONG_MAX;
+	return event_queue.top()->get_time();
+}
+
 /* private helper functions */
 
 // should be here only in FINISHED state - leave in FINISHED state
@@ -218,6 +261,17 @@ void Coordinator::shutdown()
 			<< process_run_time << " sec (process), " 
 			<< wallclock_run_time << " sec (wallclock)" << endl;
 		}
+	if(dispatch_statistics_enabled) {
+		if(Normal_out)
+			dispatch_statistics.display_summary(Normal_out, current_time);
+		if(!dispatch_statistics_filename.empty()) {
+			ofstream report(dispatch_statistics_filename.c_str());
+			if(report)
+				dispatch_statistics.write_csv(report, current_time);
+			else if(Normal_out)
+				Normal_out << "Could not open " << dispatch_statistics_filename << " for the dispatch statistics report" << endl;
+			}
+		}
 }
 
 // Tell each processor to initialize itself by resetting all of its state variable to initial values. 
@@ -246,9 +300,8 @@ void Coordinator::send_start_event()
 	for (list<Processor *>::iterator it = processor_list.begin(); it != processor_list.end(); ++it) {
 		Processor * proc_ptr = *it;
 		Assert(proc_ptr);
-		const Event * event_ptr = new Start_event(current_time, proc_ptr);
-		event_ptr->send_self(proc_ptr);
-		delete event_ptr;
+		Start_event start_event(current_time, proc_ptr);
+		start_event.send_self(proc_ptr);
 		}
 	state = STARTED;
 }
@@ -259,9 +312,8 @@ void Coordinator::send_stop_event()
 	for (list<Processor *>::iterator it = processor_list.begin(); it != processor_list.end(); ++it) {
 		Processor * proc_ptr = *it;
 		Assert(proc_ptr);
-		const Event * event_ptr = new Stop_event(current_time, proc_ptr);
-		event_ptr->send_self(proc_ptr);
-		delete event_ptr;
+		Stop_event stop_event(current_time, proc_ptr);
+		stop_event.send_self(proc_ptr);
 		}
 }
 
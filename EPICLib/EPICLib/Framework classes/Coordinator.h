@@ -16,16 +16,21 @@ While running, it is in the RUNNING state.
 If it stops running before it is finished, it goes into the PAUSED state.
 If the model completes, or it is told to halt, it goes into the FINISHED state.
 
+There is one Coordinator, with its own event queue and simulated time, for each thread.
+The processors created in a thread register with that thread's Coordinator, so a separate 
+simulation (e.g. a Model with its Human_processor and Device_processor) can be created and run 
+in each of several threads at the same time. See Model_batch_runner.
 */
 
 #ifndef COORDINATOR_H
 #define COORDINATOR_H
 
-#include "Event_base.h"	// need definition of Event, greater_Event_ptr
+#include "Event_base.h"	// need definition of Event
+#include "Event_queue.h"
+#include "Dispatch_statistics.h"
 
 #include <list>
-#include <vector>
-#include <queue>
+#include <string>
 #include <ctime>
 
 // forward declarations
@@ -33,12 +38,19 @@ class Processor;
 
 class Coordinator {
 public:
-	// create if needed, and return the pointer to the singleton Coordinator
+	// create if needed, and return the Coordinator for the calling thread
 	static Coordinator & get_instance();	
+	// delete the Coordinator for the calling thread, if any, together with any events still in its queue;
+	// the thread's processors must already have been destroyed
+	static void release_thread_instance();
 	
-	// get the universal time
+	// get the universal time for the calling thread's simulation
 	static long get_time()
 		{return current_time;}
+	// get the serial number of the event most recently delivered from the queue;
+	// with the time, this gives the position of the current event in the order of delivery
+	static long get_current_serial_number()
+		{return current_serial_number;}
 				
 	/*** Simulation control interface ***/
 	// setup the simulation and initialize the processors
@@ -82,17 +94,42 @@ public:
 	// call the processor with a event and immediately return to originator processor.
 	// this enables the recorders to notice the event even though function-call logic is actually involved.
 	void call_with_event(Event&); 
+	// the time of the earliest event waiting for delivery, LONG_MAX if there are none
+	long get_next_event_time();
+	// the last time at which events will be delivered before the current run_for returns
+	long get_run_end_time() const
+		{return run_end_time;}
+
+	/*** Dispatch statistics ***/
+	// if enabled, each event delivered from the queue is counted and timed by destination processor
+	// and event type; at shutdown a summary is output, and the CSV report is written to the file if one was named
+	bool get_dispatch_statistics_enabled() const
+		{return dispatch_statistics_enabled;}
+	void set_dispatch_statistics_enabled(bool flag)
+		{dispatch_statistics_enabled = flag;}
+	void set_dispatch_statistics_filename(const std::string& filename)
+		{dispatch_statistics_filename = filename;}
+	const Dispatch_statistics& get_dispatch_statistics() const
+		{return dispatch_statistics;}
 	
 private:
-	static long current_time;	// the true universal current simulated time
+	static thread_local long current_time;	// the true universal current simulated time
+	static thread_local long current_serial_number;	// of the event being delivered
+	static thread_local Coordinator * Coordinator_ptr;
 	enum Simulation_state_e {UNREADY, INITIALIZED, STARTED, RUNNING, TIMED_OUT, PAUSED, FINISHED};
 	Simulation_state_e state;	// state of simulation
+	long run_end_time;			// time_out_time of the current run_for
 	std::list<Processor *> processor_list;		// list of processors
 	std::time_t start_wallclock_time;	// for process time output
 	std::clock_t start_process_time;	// for process time output
 	
-	typedef std::priority_queue<const Event *, std::vector<const Event *>, greater_Event_ptr > Event_ptr_priority_queue_t;
-	Event_ptr_priority_queue_t event_queue;	// schedule queue of events
+	Event_queue event_queue;	// schedule queue of events
+	// delete the events in the queue and return how many there were
+	int delete_queued_events();
+
+	bool dispatch_statistics_enabled;
+	std::string dispatch_statistics_filename;
+	Dispatch_statistics dispatch_statistics;
 	
 	/* private helper functions */
 	void initialize_processors();
@@ -0,0 +1,153 @@
+#include "Dispatch_statistics.h"
+#include "Event_base.h"
+#include "Processor.h"
+#include "Output_tee.h"
+
+#include <iostream>
+#include <typeinfo>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+using std::ostream;	using std::endl;
+using std::string;
+using std::map;
+using std::vector;
+using std::pair;
+using std::type_index;
+using std::stable_sort;
+using std::size_t;
+using std::free;
+
+void Dispatch_statistics::clear()
+{
+	entries.clear();
+	total_events = 0;
+	total_time = 0.;
+	queue_high_water = 0;
+}
+
+void Dispatch_statistics::record(const Event * event_ptr, const Processor * proc_ptr, double seconds)
+{
+	Entry& entry = entries[Key_t(proc_ptr, type_index(typeid(*event_ptr)))];
+	// names are saved when the entry is created, in case the processor is later destroyed
+	if(entry.count == 0) {
+		entry.processor_name = (proc_ptr) ? proc_ptr->get_name() : string("none");
+		entry.event_type_name = get_type_name(typeid(*event_ptr));
+		}
+	entry.count++;
+	entry.total_time += seconds;
+	if(seconds > entry.max_time)
+		entry.max_time = seconds;
+	entry.histogram[get_histogram_bin(seconds)]++;
+	total_events++;
+	total_time += seconds;
+}
+
+// the readable name of a type; the implementation's name is demangled where the ABI allows,
+// otherwise the length prefix of a mangled name is removed
+string Dispatch_statistics::get_type_name(const std::type_info& type)
+{
+	const char * mangled_name = type.name();
+#ifdef __GNUG__
+	int status = 0;
+	char * demangled_name = abi::__cxa_demangle(mangled_name, 0, 0, &status);
+	if(status == 0 && demangled_name) {
+		string result(demangled_name);
+		free(demangled_name);
+		return result;
+		}
+#endif
+	while(std::isdigit(static_cast<unsigned char>(*mangled_name)))
+		mangled_name++;
+	return string(mangled_name);
+}
+
+// combine the entries that have the same processor and event type names, ordered by the names;
+// the entries themselves are ordered by processor address, which differs from run to run
+Dispatch_statistics::Named_entries_t Dispatch_statistics::get_named_entries() const
+{
+	Named_entries_t named_entries;
+	for(Entries_t::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+		const Entry& entry = it->second;
+		Entry& named_entry = named_entries[Name_key_t(entry.processor_name, entry.event_type_name)];
+		named_entry.processor_name = entry.processor_name;
+		named_entry.event_type_name = entry.event_type_name;
+		named_entry.count += entry.count;
+		named_entry.total_time += entry.total_time;
+		if(entry.max_time > named_entry.max_time)
+			named_entry.max_time = entry.max_time;
+		for(int bin = 0; bin < n_histogram_bins; bin++)
+			named_entry.histogram[bin] += entry.histogram[bin];
+		}
+	return named_entries;
+}
+
+int Dispatch_statistics::get_histogram_bin(double seconds)
+{
+	double microseconds = seconds * 1.e6;
+	int bin = 0;
+	for(double limit = 1.; bin < n_histogram_bins - 1 && microseconds >= limit; limit *= 2.)
+		bin++;
+	return bin;
+}
+
+// comparison for sorting the processor totals
+static bool greater_time(const pair<string, pair<long, double> >& lhs, const pair<string, pair<long, double> >& rhs)
+{
+	return lhs.second.second > rhs.second.second;
+}
+
+void Dispatch_statistics::display_summary(Output_tee& ot, long simulated_time) const
+{
+	// total the entries for each processor by name
+	map<string, pair<long, double> > processor_totals;
+	for(Entries_t::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+		pair<long, double>& totals = processor_totals[it->second.processor_name];
+		totals.first += it->second.count;
+		totals.second += it->second.total_time;
+		}
+	// processors with equal times stay in name order
+	vector<pair<string, pair<long, double> > > sorted_totals(processor_totals.begin(), processor_totals.end());
+	stable_sort(sorted_totals.begin(), sorted_totals.end(), greater_time);
+
+	ot << total_events << " events dispatched in " << total_time << " sec";
+	if(simulated_time > 0)
+		ot << ", " << total_events / (double(simulated_time) / 1000.) << " events per simulated sec";
+	ot << ", queue high-water mark " << queue_high_water << endl;
+	for(size_t i = 0; i < sorted_totals.size(); i++) {
+		ot << sorted_totals[i].first << ": " << sorted_totals[i].second.first << " events, "
+			<< sorted_totals[i].second.second << " sec";
+		if(total_time > 0.)
+			ot << " (" << 100. * sorted_totals[i].second.second / total_time << "%)";
+		ot << endl;
+		}
+}
+
+void Dispatch_statistics::write_csv(ostream& os, long simulated_time) const
+{
+	os << "# total_events," << total_events << endl;
+	os << "# total_dispatch_time_sec," << total_time << endl;
+	os << "# simulated_time_sec," << double(simulated_time) / 1000. << endl;
+	os << "# events_per_simulated_sec," << ((simulated_time > 0) ? total_events / (double(simulated_time) / 1000.) : 0.) << endl;
+	os << "# queue_high_water," << queue_high_water << endl;
+
+	os << "processor,event_type,count,total_time_sec,mean_time_usec,max_time_usec,lt_1usec";
+	for(int bin = 1; bin < n_histogram_bins - 1; bin++)
+		os << ",lt_" << (1L << bin) << "usec";
+	os << ",ge_" << (1L << (n_histogram_bins - 2)) << "usec" << endl;
+
+	Named_entries_t named_entries = get_named_entries();
+	for(Named_entries_t::const_iterator it = named_entries.begin(); it != named_entries.end(); ++it) {
+		const Entry& entry = it->second;
+		os << entry.processor_name << ',' << entry.event_type_name << ',' << entry.count << ','
+			<< entry.total_time << ',' << 1.e6 * entry.total_time / entry.count << ',' << 1.e6 * entry.max_time;
+		for(int bin = 0; bin < n_histogram_bins; bin++)
+			os << ',' << entry.histogram[bin];
+		os << endl;
+		}
+}
@@ -0,0 +1,83 @@
+/*
+Dispatch_statistics accumulates the Coordinator's measurements of event delivery:
+for each combination of destination Processor and dynamic event type, the number of
+events delivered and the wall time spent in their delivery, with a histogram of the
+delivery times; and the high-water mark of the event queue depth.
+
+The summary is intended for the normal output at the end of a run; the CSV report
+has one row for each processor and event type, preceded by comment lines starting with
+'#' that contain the overall totals. Event types are reported by their demangled class
+names, and the rows are in order of processor name and then event type name, so that
+reports from different runs can be compared line by line.
+*/
+
+#ifndef DISPATCH_STATISTICS_H
+#define DISPATCH_STATISTICS_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <typeindex>
+#include <typeinfo>
+#include <iosfwd>
+#include <cstddef>
+
+// forward declarations
+class Event;
+class Processor;
+class Output_tee;
+
+class Dispatch_statistics {
+public:
+	Dispatch_statistics() :
+		total_events(0), total_time(0.), queue_high_water(0)
+		{}
+
+	void clear();
+	// record the delivery of an event to a processor that took the supplied number of seconds
+	void record(const Event * event_ptr, const Processor * proc_ptr, double seconds);
+	// note the current depth of the event queue
+	void note_queue_depth(std::size_t depth)
+		{if(depth > queue_high_water) queue_high_water = depth;}
+
+	long get_total_events() const
+		{return total_events;}
+	std::size_t get_queue_high_water() const
+		{return queue_high_water;}
+
+	// output the totals for each processor, in order of decreasing time
+	void display_summary(Output_tee& ot, long simulated_time) const;
+	// output the comma-separated report
+	void write_csv(std::ostream& os, long simulated_time) const;
+
+private:
+	// bin 0 is less than 1 microsecond, bin i is less than 2^i microseconds, the last bin is the rest
+	enum {n_histogram_bins = 18};
+
+	struct Entry {
+		Entry() : count(0), total_time(0.), max_time(0.), histogram()
+			{}
+		std::string processor_name;
+		std::string event_type_name;
+		long count;
+		double total_time;
+		double max_time;
+		long histogram[n_histogram_bins];
+	};
+
+	typedef std::pair<const Processor *, std::type_index> Key_t;
+	typedef std::map<Key_t, Entry> Entries_t;
+	// for output, entries are combined by processor and event type names
+	typedef std::pair<std::string, std::string> Name_key_t;
+	typedef std::map<Name_key_t, Entry> Named_entries_t;
+	Entries_t entries;
+	long total_events;
+	double total_time;
+	std::size_t queue_high_water;
+
+	Named_entries_t get_named_entries() const;
+	static std::string get_type_name(const std::type_info& type);
+	static int get_histogram_bin(double seconds);
+};
+
+#endif
@@ -1,4 +1,15 @@
 #include "Event_base.h"
+#include "Event_pool.h"
 
-long Event::counter = 0;	//serial number counter
+thread_local long Event::counter = 0;	//serial number counter
 
+void * Event::operator new(std::size_t size)
+{
+	return Event_pool::get_instance().allocate(size);
+}
+
+// the virtual destructor ensures that size is that of the actual event type
+void Event::operator delete(void * p, std::size_t size)
+{
+	Event_pool::get_instance().deallocate(p, size);
+}
@@ -2,10 +2,12 @@
 // Originator allocates them with new.
 // Coordinator will deallocate them after they are sent.
 // Event receivers should declare parameter as const Event_type *.
+// The memory for all events comes from the Event_pool.
 
 #ifndef EVENT_BASE_H
 #define EVENT_BASE_H
 
+#include <cstddef>
 
 // forward declarations
 class Processor;
@@ -14,6 +16,9 @@ class Event {
 public:
 	virtual ~Event() {}
 	virtual void send_self(Processor *) const = 0; // this class is abstract
+	// allocate and deallocate all Event subclass objects from the Event_pool
+	static void * operator new(std::size_t size);
+	static void operator delete(void * p, std::size_t size);
 	long get_time() const 
 		{return time;}
 	Processor * get_destination() const 
@@ -28,8 +33,14 @@ public:
 			return false;
 		}
 
+	long get_serial_number() const
+		{return serial_number;}
+
 	// just for measurement purposes
 	static long get_counter() {return counter;}
+	// take the next serial number for something that is not put in the event queue, but must
+	// be ordered as if it were an event scheduled at this point
+	static long reserve_serial_number() {return counter++;}
 
 protected:
 	Event(long t, Processor * d) : time(t), serial_number(counter++), destination(d) {}
@@ -38,7 +49,7 @@ private:
 	long time;
 	long serial_number;	// used to break ties on time - lowest is earliest
 	Processor * destination;
-	static long counter;
+	static thread_local long counter;	// one per thread, like the Coordinator
 };
 
 // comparitor function object for Event *s - greater for the priority queue
@@ -0,0 +1,82 @@
+#include "Event_pool.h"
+#include "Assert_throw.h"
+
+#include <new>
+
+using std::size_t;
+
+thread_local Event_pool * Event_pool::Event_pool_ptr = 0;
+
+// Like Symbol_memory, this is not a Meyers singleton because events might
+// get deleted during static destruction after the pool would have been destructed.
+Event_pool& Event_pool::get_instance()
+{
+	if(!Event_pool_ptr)
+		Event_pool_ptr = new Event_pool;
+	return *Event_pool_ptr;
+}
+
+void Event_pool::release_thread_instance()
+{
+	delete Event_pool_ptr;
+	Event_pool_ptr = 0;
+}
+
+Event_pool::Event_pool() :
+	chunk_next(0), chunk_end(0)
+{
+	for(int i = 0; i < n_size_classes; i++)
+		free_lists[i] = 0;
+}
+
+Event_pool::~Event_pool()
+{
+	for(size_t i = 0; i < chunks.size(); i++)
+		::operator delete(chunks[i]);
+}
+
+void * Event_pool::allocate(size_t size)
+{
+	if(size == 0)
+		size = 1;
+	if(size > max_pooled_size)
+		return ::operator new(size);
+	size_t size_class = get_size_class(size);
+	Free_block * block_ptr = free_lists[size_class];
+	if(block_ptr) {
+		free_lists[size_class] = block_ptr->next;
+		return block_ptr;
+		}
+	return allocate_from_chunk((size_class + 1) * granularity);
+}
+
+void Event_pool::deallocate(void * p, size_t size)
+{
+	if(!p)
+		return;
+	if(size == 0)
+		size = 1;
+	if(size > max_pooled_size) {
+		::operator delete(p);
+		return;
+		}
+	size_t size_class = get_size_class(size);
+	Free_block * block_ptr = static_cast<Free_block *>(p);
+	block_ptr->next = free_lists[size_class];
+	free_lists[size_class] = block_ptr;
+}
+
+// take the block from the current chunk, starting a new chunk if there is not enough left;
+// any left-over space at the end of the old chunk is not used.
+void * Event_pool::allocate_from_chunk(size_t block_size)
+{
+	if(size_t(chunk_end - chunk_next) < block_size) {
+		chunk_next = static_cast<char *>(::operator new(chunk_size));
+		chunk_end = chunk_next + chunk_size;
+		chunks.push_back(chunk_next);
+		}
+	void * p = chunk_next;
+	chunk_next += block_size;
+	Assert(chunk_next <= chunk_end);
+	return p;
+}
@@ -0,0 +1,59 @@
+/*
+Event_pool supplies the memory for all Event objects. Event overrides operator new and
+operator delete to use it, so the contract that an originator creates an event with new and
+the Coordinator deletes it after delivery is unchanged.
+
+Memory is carved out of large chunks and kept on a free list for each size class (multiples
+of granularity bytes), so allocating an event is normally just popping a free list, and
+freeing it is pushing it back on. Freed blocks are re-used for later events of the same size
+class, so the events do not fragment the general heap over long runs. Chunks are never
+returned to the general heap. Events too large for any size class are allocated normally.
+
+Like the Coordinator, there is one Event_pool per thread; since a simulation's events are
+created and deleted in the thread that runs it, no locking is needed.
+*/
+
+#ifndef EVENT_POOL_H
+#define EVENT_POOL_H
+
+#include <vector>
+#include <cstddef>
+
+class Event_pool {
+public:
+	// create if needed, and return the Event_pool for the calling thread
+	static Event_pool& get_instance();
+	// delete the Event_pool for the calling thread, if any, returning its chunks to the general heap;
+	// all of the events allocated from it must already have been deleted
+	static void release_thread_instance();
+
+	void * allocate(std::size_t size);
+	// size must be the same as was supplied to allocate
+	void deallocate(void * p, std::size_t size);
+
+private:
+	enum {granularity = 16, max_pooled_size = 256, n_size_classes = max_pooled_size / granularity,
+		chunk_size = 64 * 1024};
+
+	struct Free_block {
+		Free_block * next;
+		};
+
+	Free_block * free_lists[n_size_classes];
+	std::vector<char *> chunks;	// all of the chunks obtained so far
+	char * chunk_next;			// next unused byte in the current chunk
+	char * chunk_end;			// one past the last byte in the current chunk
+
+	static thread_local Event_pool * Event_pool_ptr;
+
+	static std::size_t get_size_class(std::size_t size)
+		{return (size - 1) / granularity;}
+	void * allocate_from_chunk(std::size_t block_size);
+
+	Event_pool();
+	~Event_pool();
+	Event_pool(const Event_pool&);	// no copy
+	Event_pool& operator= (const Event_pool&);	// no assignment
+};
+
+#endif
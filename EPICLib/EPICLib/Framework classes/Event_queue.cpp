@@ -0,0 +1,110 @@
+#include "Event_queue.h"
+#include "Assert_throw.h"
+
+#include <algorithm>
+
+using std::size_t;
+using std::upper_bound;
+
+Event_queue::Event_queue() :
+	buckets(n_buckets), base_time(0), n_bucketed(0)
+{}
+
+// put the event in its calendar bucket if it is in the window, in the overflow heap if not
+void Event_queue::push(const Event * event_ptr)
+{
+	if(in_window(event_ptr->get_time()))
+		insert_in_bucket(event_ptr);
+	else
+		overflow.push(event_ptr);
+}
+
+const Event * Event_queue::top()
+{
+	Assert(!empty());
+	if(overflow_is_earliest())
+		return overflow.top();
+	const Bucket& bucket = get_bucket(base_time);
+	return bucket.events[bucket.head];
+}
+
+void Event_queue::pop()
+{
+	Assert(!empty());
+	if(overflow_is_earliest()) {
+		overflow.pop();
+		return;
+		}
+	Bucket& bucket = get_bucket(base_time);
+	++bucket.head;
+	--n_bucketed;
+	// once emptied, keep the storage for the next use of the bucket
+	if(bucket.empty()) {
+		bucket.events.clear();
+		bucket.head = 0;
+		}
+}
+
+void Event_queue::reset(long start_time)
+{
+	Assert(empty());
+	base_time = start_time;
+}
+
+/* private helper functions */
+
+// all events in a bucket have the same time, so keep them in serial_number order.
+// Events are normally scheduled in serial number order, so this is usually an append.
+void Event_queue::insert_in_bucket(const Event * event_ptr)
+{
+	Bucket& bucket = get_bucket(event_ptr->get_time());
+	if(bucket.empty() || !less_Event_ptr()(event_ptr, bucket.events.back()))
+		bucket.events.push_back(event_ptr);
+	else
+		bucket.events.insert(
+			upper_bound(bucket.events.begin() + bucket.head, bucket.events.end(), event_ptr, less_Event_ptr()),
+			event_ptr);
+	++n_bucketed;
+}
+
+// move the window forward until the earliest bucket has an event in it,
+// bringing overflow events into the calendar as they come into the window.
+// If the calendar is empty, jump the window directly to the earliest overflow event.
+void Event_queue::advance_to_earliest()
+{
+	if(n_bucketed == 0) {
+		if(overflow.empty())
+			return;
+		long earliest_time = overflow.top()->get_time();
+		if(earliest_time > base_time)
+			base_time = earliest_time;
+		move_from_overflow();
+		return;
+		}
+	while(get_bucket(base_time).empty()) {
+		++base_time;
+		move_from_overflow();
+		}
+}
+
+// An event scheduled earlier than the window stays in the overflow heap
+// until delivered, and blocks moving any others until then - this is rare.
+void Event_queue::move_from_overflow()
+{
+	while(!overflow.empty() && in_window(overflow.top()->get_time())) {
+		insert_in_bucket(overflow.top());
+		overflow.pop();
+		}
+}
+
+// true if the earliest event is in the overflow heap rather than the calendar
+bool Event_queue::overflow_is_earliest()
+{
+	advance_to_earliest();
+	if(overflow.empty())
+		return false;
+	if(n_bucketed == 0)
+		return true;
+	const Bucket& bucket = get_bucket(base_time);
+	return less_Event_ptr()(overflow.top(), bucket.events[bucket.head]);
+}
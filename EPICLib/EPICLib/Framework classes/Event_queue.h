@@ -0,0 +1,81 @@
+/*
+Event_queue is the Coordinator's schedule queue. It is a calendar (bucket) queue
+keyed on the integer millisecond event time, with an overflow heap for events
+that are outside of the calendar window.
+
+The calendar is a ring of n_buckets buckets, one per millisecond, covering the
+times [base_time, base_time + n_buckets). All of the events in a bucket have the
+same time, so they only need to be kept in serial_number order; since events are
+almost always scheduled in the order they were created, this is normally just
+an append. Events earlier or later than the calendar window go into the overflow
+heap, and far-future events are moved from the heap into the calendar as the
+window advances.
+
+The delivery order is identical to that of a priority queue ordered by
+greater_Event_ptr: earliest time first, ties broken by lowest serial number.
+
+Like the priority queue it replaces, the queue does not own the events;
+the Coordinator is responsible for deleting them.
+*/
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "Event_base.h"	// need definition of Event, greater_Event_ptr
+
+#include <vector>
+#include <queue>
+#include <cstddef>
+
+class Event_queue {
+public:
+	Event_queue();
+
+	bool empty() const
+		{return (n_bucketed == 0 && overflow.empty());}
+	std::size_t size() const
+		{return n_bucketed + overflow.size();}
+
+	// put an event into the queue
+	void push(const Event * event_ptr);
+	// return the earliest event; the queue must not be empty
+	const Event * top();
+	// remove the earliest event; the queue must not be empty
+	void pop();
+
+	// restart the calendar at the supplied time; the queue must be empty
+	void reset(long start_time);
+
+private:
+	// the calendar window must be a power of two so that a time can be masked into a bucket index;
+	// 1024 ms covers about 20 cognitive cycles, which includes almost all scheduled events
+	enum {n_buckets = 1024, bucket_mask = n_buckets - 1};
+
+	// a bucket holds the events for a single time in serial_number order;
+	// events before head have already been removed - storage is re-used once the bucket is emptied
+	struct Bucket {
+		Bucket() : head(0) {}
+		std::vector<const Event *> events;
+		std::size_t head;
+		bool empty() const
+			{return head == events.size();}
+		};
+
+	std::vector<Bucket> buckets;
+	long base_time;			// the time of the earliest bucket in the calendar window
+	std::size_t n_bucketed;	// number of events in the calendar buckets
+
+	typedef std::priority_queue<const Event *, std::vector<const Event *>, greater_Event_ptr > Event_ptr_priority_queue_t;
+	Event_ptr_priority_queue_t overflow;	// events outside the calendar window
+
+	bool in_window(long t) const
+		{return (t >= base_time && t < base_time + n_buckets);}
+	Bucket& get_bucket(long t)
+		{return buckets[t & bucket_mask];}
+	void insert_in_bucket(const Event * event_ptr);
+	void advance_to_earliest();
+	void move_from_overflow();
+	bool overflow_is_earliest();
+};
+
+#endif
@@ -2,7 +2,7 @@
 #include "Output_tee_globals.h"
 #include "Output_tee.h"
 
-Output_tee Normal_out;
-Output_tee Trace_out;
+thread_local Output_tee Normal_out;
+thread_local Output_tee Trace_out;
 //Output_tee Detail_out;
 //Output_tee Debug_out;
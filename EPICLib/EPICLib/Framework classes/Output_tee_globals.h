@@ -2,9 +2,10 @@
 #define OUTPUT_TEE_GLOBALS_H
 #include "Output_tee.h"
 
-// global output objects
-extern Output_tee Normal_out;
-extern Output_tee Trace_out;
+// global output objects - each thread has its own, so that simulations
+// run in separate threads do not interleave their output
+extern thread_local Output_tee Normal_out;
+extern thread_local Output_tee Trace_out;
 //extern Output_tee Detail_out;
 //extern Output_tee Debug_out;
 
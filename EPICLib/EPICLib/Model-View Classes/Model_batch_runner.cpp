@@ -0,0 +1,60 @@
+#include "Model_batch_runner.h"
+#include "Coordinator.h"
+#include "Event_pool.h"
+#include "Random_utilities.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <exception>
+
+using std::thread;
+using std::atomic;
+using std::vector;
+using std::exception_ptr;	using std::current_exception;	using std::rethrow_exception;
+
+Model_batch_runner::Model_batch_runner(int n_threads_, unsigned long base_seed_) :
+	n_threads(n_threads_), base_seed(base_seed_)
+{
+	if(n_threads <= 0)
+		n_threads = int(thread::hardware_concurrency());
+	if(n_threads <= 0)
+		n_threads = 1;
+}
+
+// each worker thread takes the next run index until all of the runs have been started,
+// and seeds its random number generator for each run
+void Model_batch_runner::run(int n_runs, Run_function_t run_function)
+{
+	if(n_runs <= 0)
+		return;
+	atomic<int> next_run(0);
+	vector<exception_ptr> run_exceptions(n_runs);
+
+	auto worker = [&]() {
+		for(int run_index = next_run++; run_index < n_runs; run_index = next_run++) {
+			try {
+				set_random_number_generator_seed(base_seed + run_index);
+				run_function(run_index);
+				}
+			catch(...) {
+				run_exceptions[run_index] = current_exception();
+				}
+			}
+		// the runs have destroyed their models, so the thread's Coordinator and its left-over events,
+		// and then the thread's Event_pool, can be freed before the thread exits
+		Coordinator::release_thread_instance();
+		Event_pool::release_thread_instance();
+		};
+
+	int n_workers = (n_threads < n_runs) ? n_threads : n_runs;
+	vector<thread> workers;
+	for(int i = 0; i < n_workers; i++)
+		workers.push_back(thread(worker));
+	for(int i = 0; i < n_workers; i++)
+		workers[i].join();
+
+	for(int run_index = 0; run_index < n_runs; run_index++)
+		if(run_exceptions[run_index])
+			rethrow_exception(run_exceptions[run_index]);
+}
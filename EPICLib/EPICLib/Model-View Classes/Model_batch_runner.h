@@ -0,0 +1,58 @@
+/*
+Model_batch_runner distributes a batch of independent simulation runs, such as the
+points of a parameter sweep, over a set of worker threads in the same process.
+
+Each run is done by calling the supplied run function with the index of the run
+on one of the worker threads. The run function should create its own device and
+Model on that thread, compile, run, and collect the results, and destroy them
+before returning. Each thread has its own Coordinator, simulated time, event pool,
+random number generator, Normal_out/Trace_out/PPS_out, network node debug flags, and
+Widget screen settings; Symbols are shared by all threads. A worker thread starts with
+the default values of these settings, not those of the calling thread, and they carry
+over from one run to the next on the same thread, so a run function that needs other
+values (e.g. for the Widget screen size) should set them at the start of every run.
+The Coordinator and event pool of each worker thread are freed when the thread has
+finished its runs.
+
+Results should be saved by the run function into storage for that run index,
+e.g. a vector sized for the number of runs.
+
+Before each run, the thread's random number generator is seeded with the base seed
+plus the run index, so a run gets the same random sequence no matter which thread
+does it or which runs came before it on that thread. The default base seed is the
+engine's own default, so run 0 behaves like an unseeded single run. A Model with a
+non-zero random number generator seed reseeds the generator when it is initialized,
+so such a seed should also differ between runs, e.g. by adding the run index.
+
+If any run throws an exception, the remaining runs are still done, and then the
+exception from the lowest-numbered failed run is rethrown from run().
+*/
+
+#ifndef MODEL_BATCH_RUNNER_H
+#define MODEL_BATCH_RUNNER_H
+
+#include "Random_utilities.h"
+
+#include <functional>
+
+class Model_batch_runner {
+public:
+	typedef std::function<void (int)> Run_function_t;
+
+	// if n_threads_ is zero, use the number of hardware threads
+	Model_batch_runner(int n_threads_ = 0, unsigned long base_seed_ = Random_engine_t::default_seed);
+
+	int get_n_threads() const
+		{return n_threads;}
+	unsigned long get_base_seed() const
+		{return base_seed;}
+
+	// do runs 0 through n_runs - 1, and return when all are done
+	void run(int n_runs, Run_function_t run_function);
+
+private:
+	int n_threads;
+	unsigned long base_seed;
+};
+
+#endif
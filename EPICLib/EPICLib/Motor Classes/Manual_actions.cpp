@@ -138,7 +138,7 @@ long Manual_Keystroke_action::prepare(long base_time)
 long Manual_Keystroke_action::execute(long base_time)
 {
 	double fluctuation = get_processor_ptr()->get_execution_fluctuation();
-	long keystroke_execution_time = get_processor_ptr()->get_parameter_ptr("KLM_keystroke_execution_time")->get_long_value();
+	long keystroke_execution_time = get_processor_ptr()->get_keystroke_execution_time().get_long_value();
 	keystroke_execution_time = keystroke_execution_time - get_processor_ptr()->get_initiation_time();
 	long execution_time = long((keystroke_execution_time + get_processor_ptr()->auto_home_to_keyboard()) * fluctuation);
 	long movement_completion_time = base_time + execution_time;
@@ -186,7 +186,7 @@ long Manual_Hold_action::prepare(long base_time)
 long Manual_Hold_action::execute(long base_time)
 {
 	double fluctuation = get_processor_ptr()->get_execution_fluctuation();
-	long hold_execution_time = get_processor_ptr()->get_parameter_ptr("KLM_hold_release_execution_time")->get_long_value();
+	long hold_execution_time = get_processor_ptr()->get_hold_release_execution_time().get_long_value();
 	hold_execution_time = hold_execution_time - get_processor_ptr()->get_initiation_time();
 	long execution_time = long((hold_execution_time + get_processor_ptr()->auto_home_to_mouse()) * fluctuation);
 	long movement_completion_time = base_time + execution_time;
@@ -234,7 +234,7 @@ long Manual_Release_action::prepare(long base_time)
 long Manual_Release_action::execute(long base_time)
 {
 	double fluctuation = get_processor_ptr()->get_execution_fluctuation();
-	long release_execution_time = get_processor_ptr()->get_parameter_ptr("KLM_hold_release_execution_time")->get_long_value();
+	long release_execution_time = get_processor_ptr()->get_hold_release_execution_time().get_long_value();
 	release_execution_time = release_execution_time - get_processor_ptr()->get_initiation_time();
 	long execution_time = long((release_execution_time + get_processor_ptr()->auto_home_to_mouse()) * fluctuation);
 	long movement_completion_time = base_time + execution_time;
@@ -315,7 +315,7 @@ long Manual_Punch_action::execute(long base_time)
 	//	tell tactile that movement has started at base_time
 	/* not implemented yet */
 	//	tell device that key has closed at base_time + key closure time
-	long key_closure_time = get_processor_ptr()->get_parameter_ptr("Key_closure_time")->get_long_value();
+	long key_closure_time = get_processor_ptr()->get_key_closure_time().get_long_value();
 	long device_input_time = base_time + long(key_closure_time * fluctuation);
 	Coordinator::get_instance().schedule_event(new 
 		Device_Keystroke_event(device_input_time, get_device_ptr(), keyname));
@@ -244,7 +244,7 @@ long Manual_aimed_action::generate_movement_events(long base_time)
 	
 	// generate a string of intermediate position events with no specified target name
 	// assuming linear here
-	long subevent_time = get_processor_ptr()->get_parameter_ptr("Subevent_time")->get_long_value();
+	long subevent_time = get_processor_ptr()->get_subevent_time().get_long_value();
 	int number_of_subevents = int(movement_time / subevent_time);	// integer division on purpose
 	Assert(number_of_subevents > 0);
 	double subevent_r = movement_vector.r / number_of_subevents;
@@ -336,8 +336,8 @@ Manual_Ply_action::Manual_Ply_action(Human_processor * human_ptr_, Symbol_list_t
 	
 double Manual_Ply_action::determine_movement_time() const
 {
-	long coefficient = get_processor_ptr()->get_parameter_ptr("Ply_coefficient")->get_long_value();
-	long minimum_time = get_processor_ptr()->get_parameter_ptr("Ply_minimum_time")->get_long_value();
+	long coefficient = get_processor_ptr()->get_ply_coefficient().get_long_value();
+	long minimum_time = get_processor_ptr()->get_ply_minimum_time().get_long_value();
 	return pointing_time(coefficient, minimum_time);
 }
 
@@ -390,15 +390,15 @@ double Manual_Point_action::determine_movement_time() const
 {
 	double movement_time;
 	if(target_size == GU::Size()) {
-		long KLM_point_time = get_processor_ptr()->get_parameter_ptr("KLM_point_time")->get_long_value();
+		long KLM_point_time = get_processor_ptr()->get_KLM_point_time().get_long_value();
 		movement_time = double(KLM_point_time - 2 * get_processor_ptr()->get_feature_time() - get_processor_ptr()->get_initiation_time());
 		}
 	else {
 		long coefficient = (get_processor_ptr()->get_button_held()) ?
-			get_processor_ptr()->get_parameter_ptr("Point_coefficient_button_held")->get_long_value()
+			get_processor_ptr()->get_point_coefficient_button_held().get_long_value()
 			:
-			get_processor_ptr()->get_parameter_ptr("Point_coefficient")->get_long_value();
-		long minimum_time = get_processor_ptr()->get_parameter_ptr("Point_minimum_time")->get_long_value();
+			get_processor_ptr()->get_point_coefficient().get_long_value();
+		long minimum_time = get_processor_ptr()->get_point_minimum_time().get_long_value();
 		movement_time = pointing_time(coefficient, minimum_time);
 		}
 	return movement_time;
@@ -442,7 +442,7 @@ long Manual_Click_on_action::generate_movement_events(long base_time)
 	// not obviously the best choice here - somewhat confusing
 	// now generate the keystroke at the end (cf Punch action)
 	//	tell device that key has closed at base_time + key closure time
-	long key_closure_time = get_processor_ptr()->get_parameter_ptr("Key_closure_time")->get_long_value();
+	long key_closure_time = get_processor_ptr()->get_key_closure_time().get_long_value();
 	double fluctuation = get_processor_ptr()->get_execution_fluctuation();
 	long device_input_time = base_time + long(key_closure_time * fluctuation);
 	Coordinator::get_instance().schedule_event(new 
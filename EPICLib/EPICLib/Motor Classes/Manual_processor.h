@@ -59,6 +59,28 @@ public:
 		{button_held = button_held_;}
 	long auto_home_to_keyboard();
 	long auto_home_to_mouse();
+	// parameters for Manual_actions, so that they need not be looked up by name;
+	// a parameter specification changes the values of these objects in place
+	const Parameter& get_keystroke_execution_time() const
+		{return keystroke_execution_time;}
+	const Parameter& get_hold_release_execution_time() const
+		{return hold_release_execution_time;}
+	const Parameter& get_key_closure_time() const
+		{return key_closure_time;}
+	const Parameter& get_point_coefficient() const
+		{return point_coefficient;}
+	const Parameter& get_point_coefficient_button_held() const
+		{return point_coefficient_button_held;}
+	const Parameter& get_point_minimum_time() const
+		{return point_minimum_time;}
+	const Parameter& get_KLM_point_time() const
+		{return KLM_point_time;}
+	const Parameter& get_ply_coefficient() const
+		{return ply_coefficient;}
+	const Parameter& get_ply_minimum_time() const
+		{return ply_minimum_time;}
+	const Parameter& get_subevent_time() const
+		{return subevent_time;}
 
 private:
 
@@ -66,7 +88,7 @@ private:
 	Symbol right_hand_position;
 	bool button_held;
 
-	// parameters (accessed via Human_subprocessor::get_parameter_ptr)
+	// parameters
 	Parameter home_time;
 	Parameter keystroke_execution_time;
 	Parameter hold_release_execution_time;
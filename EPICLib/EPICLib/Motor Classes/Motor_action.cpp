@@ -41,6 +41,14 @@ shared_ptr<Motor_action> Motor_action::create(Human_processor * human_ptr, Symbo
 	arguments.pop_front();
 
 	bool execute_when_prepared;
+	Factory_t factory = get_factory(modality, command, execute_when_prepared);
+	if(!factory)
+		return 0;
+	return factory(human_ptr, arguments, execute_when_prepared);
+}
+
+Motor_action::Factory_t Motor_action::get_factory(const Symbol& modality, const Symbol& command, bool& execute_when_prepared)
+{
 	if (command == Perform_c)
 		execute_when_prepared = true;
 	else if(command == Prepare_c)
@@ -48,13 +56,12 @@ shared_ptr<Motor_action> Motor_action::create(Human_processor * human_ptr, Symbo
 	else
 		return 0;
 
-	
 	if (modality == Manual_c) 
-		return Manual_action::create(human_ptr, arguments, execute_when_prepared);
+		return Manual_action::create;
 	else if (modality == Ocular_c) 
-		return Ocular_action::create(human_ptr, arguments, execute_when_prepared);
+		return Ocular_action::create;
 	else if (modality == Vocal_c) 
-		return Vocal_action::create(human_ptr, arguments, execute_when_prepared);
+		return Vocal_action::create;
 	else 
 		return 0;
 }
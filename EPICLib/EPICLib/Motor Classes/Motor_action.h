@@ -39,6 +39,12 @@ public:
 	// "virtual constructor" static method to construct appropriate motor action
 	// given list of action parameters - returns 0 if invalid parameters
 	static std::shared_ptr<Motor_action> create(Human_processor *, Symbol_list_t);
+	// the type of the static create methods of the modality subclasses, 
+	// which take the arguments that follow the modality and command
+	typedef std::shared_ptr<Motor_action> (*Factory_t)(Human_processor *, Symbol_list_t, bool);
+	// return the create method for the modality and set execute_when_prepared from the command;
+	// returns 0 if either is invalid
+	static Factory_t get_factory(const Symbol& modality, const Symbol& command, bool& execute_when_prepared);
 
 	// this object will send itself to the appropriate processor at the specified time
 	virtual void dispatch(long time) = 0;
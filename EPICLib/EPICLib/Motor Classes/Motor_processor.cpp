@@ -21,7 +21,7 @@ The busy booleans are there only to govern whether a signal should be sent becau
 #include "Output_tee_globals.h"
 #include "Epic_standard_symbols.h"
 #include "Motor_event_types.h"
-#include "Cognitive_event_types.h"
+#include "Cognitive_processor.h"
 #include "Motor_action.h"
 #include "Assert_throw.h"
 
@@ -339,9 +339,8 @@ void Motor_processor::signal_modality_busy()
 {
 	if(!signalled_modality_busy) {
 		signalled_modality_busy = true;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Modality_c, Free_c, Busy_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Modality_c, Free_c, Busy_c);
 		}
 }
 
@@ -349,9 +348,8 @@ void Motor_processor::signal_modality_free()
 {
 	if(signalled_modality_busy) {
 		signalled_modality_busy = false;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Modality_c, Busy_c, Free_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Modality_c, Busy_c, Free_c);
 		}
 }
 
@@ -359,9 +357,8 @@ void Motor_processor::signal_processor_busy()
 {
 	if(!signalled_processor_busy) {
 		signalled_processor_busy = true;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Processor_c, Free_c, Busy_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Processor_c, Free_c, Busy_c);
 	}
 }	
 
@@ -369,9 +366,8 @@ void Motor_processor::signal_processor_free()
 {
 	if(signalled_processor_busy) {
 		signalled_processor_busy = false;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Processor_c, Busy_c, Free_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Processor_c, Busy_c, Free_c);
 		}
 }
 
@@ -379,9 +375,8 @@ void Motor_processor::signal_preparation_busy()
 {
 	if(!signalled_preparation_busy) {
 		signalled_preparation_busy = true;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Preparation_c, Free_c, Busy_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Preparation_c, Free_c, Busy_c);
 		}
 }
 
@@ -389,9 +384,8 @@ void Motor_processor::signal_preparation_free()
 {
 	if(signalled_preparation_busy) {
 		signalled_preparation_busy = false;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Preparation_c, Busy_c, Free_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Preparation_c, Busy_c, Free_c);
 		}
 }
 
@@ -399,9 +393,8 @@ void Motor_processor::signal_execution_busy()
 {
 	if(!signalled_execution_busy) {
 		signalled_execution_busy = true;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Execution_c, Free_c, Busy_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Execution_c, Free_c, Busy_c);
 		}
 }
 
@@ -409,9 +402,8 @@ void Motor_processor::signal_execution_free()
 {
 	if(signalled_execution_busy) {
 		signalled_execution_busy = false;
-		schedule_event(new Cognitive_Update_event(
-			get_time(), get_human_ptr()->get_cognitive_ptr(), Motor_c, modality_name, 
-			Execution_c, Busy_c, Free_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time(), Motor_c, modality_name, Execution_c, Busy_c, Free_c);
 		}
 }
 
@@ -67,7 +67,7 @@ void Vocal_action::dispatch(long time)
 
 //const long syllable_time_c = 150;	// ms per syllable
 
-int Vocal_Speak_action::utterance_counter  = 0;
+thread_local int Vocal_Speak_action::utterance_counter  = 0;
 
 Vocal_Speak_action::Vocal_Speak_action(Human_processor * hum_ptr, Symbol_list_t arguments, bool overt_, bool execute_when_prepared) :
 		Vocal_action(hum_ptr, execute_when_prepared), overt(overt_)
@@ -183,7 +183,7 @@ long Vocal_Speak_action::execute(long base_time)
  // return the number of ms to articulate the utterance
 long Vocal_Speak_action::articulation_time()
 {
-	long syllable_time = get_processor_ptr()->get_parameter_ptr("Syllable_time")->get_long_value();
+	long syllable_time = get_processor_ptr()->get_syllable_time().get_long_value();
 	
 	return syllable_time * count_total_syllables(utterance.str());
 }	
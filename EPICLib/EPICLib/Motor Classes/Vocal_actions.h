@@ -56,7 +56,7 @@ private:
 	Symbol utterance;	// the string of words to be said
 	bool overt;			// true if utterrance is overt
 	long articulation_time(); 	// return the number of ms to articulate the utterance
-	static int utterance_counter;
+	static thread_local int utterance_counter;
 };
 
 
@@ -27,6 +27,9 @@ public:
 
 //	services for Vocal_actions
 	friend class Vocal_action;
+	// parameters for Vocal_actions
+	const Parameter& get_syllable_time() const
+		{return syllable_time;}
 
 private:
 
@@ -16,6 +16,14 @@ using std::ostringstream;
 using std::map;
 using std::list;
 using std::size_t;
+using std::streampos;	using std::streamoff;
+using std::ios;
+
+// the whitespace and token terminators are ASCII
+static inline bool is_whitespace(char c)
+	{return c == ' ' || c == '\n' || c == '\r' || c == '\t';}
+static inline bool is_terminator(char c)
+	{return is_whitespace(c) || c == '(' || c == ')';}
 	
 
 namespace Parsimonious_Production_System {
@@ -31,10 +39,58 @@ PPS_file_parser::PPS_file_parser(ifstream& ifs) :
 	load_predicate_info();
 }
 	
+File_token_stream::File_token_stream(ifstream& ifs) :
+	line_start(0), line_length(0), next_line_start(0), past_end(!ifs),
+	current_pos(0), next_pos(0), line_number(0), parentheses_count(0)
+{
+	read_contents(ifs);
+	load_token_info();
+}
 	
 File_token_stream::operator bool () const
 {
-	return static_cast<bool> (input_file);
+	return !past_end;
+}
+
+// read the rest of the file with a single read rather than a line at a time
+void File_token_stream::read_contents(ifstream& ifs)
+{
+	streampos start = ifs.tellg();
+	ifs.seekg(0, ios::end);
+	streamoff size = ifs.tellg() - start;
+	ifs.seekg(start);
+	if(!ifs || size <= 0)
+		return;
+	contents.resize(size_t(size));
+	ifs.read(&contents[0], size);
+	// fewer characters might be read if line endings are translated
+	contents.resize(size_t(ifs.gcount()));
+}
+
+// make the next line in contents the current line, as getline would;
+// return false if there are no more lines; like getline, this empties the current line
+// unless the last line had no newline, in which case getline fails without erasing it
+bool File_token_stream::get_next_line()
+{
+	if(next_line_start >= contents.size()) {
+		if(line_start + line_length < contents.size()) {
+			line_start = contents.size();
+			line_length = 0;
+			}
+		past_end = true;
+		return false;
+		}
+	line_start = next_line_start;
+	size_t end_pos = contents.find('\n', line_start);
+	if(end_pos == string::npos) {
+		line_length = contents.size() - line_start;
+		next_line_start = contents.size();
+		}
+	else {
+		line_length = end_pos - line_start;
+		next_line_start = end_pos + 1;
+		}
+	return true;
 }
 	
 
@@ -42,7 +98,7 @@ string File_token_stream::get_status() const
 {
 	ostringstream ss;
 	ss << "line " << line_number << " position " << current_pos << endl;
-	ss << line << endl;
+	ss << contents.substr(line_start, line_length) << endl;
 	return ss.str();
 }
 
@@ -59,7 +115,7 @@ void File_token_stream::reset()
 	current_pos = 0;
 	next_pos = string::npos;
 	line_number = 0;
-	line.clear();
+	line_length = 0;
 	parentheses_count = 0;
 }
 
@@ -798,13 +854,12 @@ string PPS_file_parser::get_token_translation(const string& token) const
 }
 */
 
-string File_token_stream::find_token(bool throw_if_not_found)
+const string& File_token_stream::find_token(bool throw_if_not_found)
 {
 //	string token;
 
 	while (!isolate_token()) {
-		getline(input_file, line);
-		if (input_file) {
+		if (get_next_line()) {
 			line_number++;
 			current_pos = 0;
 			next_pos = string::npos;	// means not set
@@ -816,8 +871,8 @@ string File_token_stream::find_token(bool throw_if_not_found)
 			current_pos = string::npos;
 			next_pos = string::npos;
 			current_token.clear();
-			line.clear();
-			return string();	// no token found
+			line_length = 0;
+			return current_token;	// no token found
 			}
 		}
 //	token was found; look up to see if the token has a translation and return it if so.
@@ -830,9 +885,9 @@ string File_token_stream::find_token(bool throw_if_not_found)
 
 // this seeks a token that is a possible term, not a delimiter 
 // default for argument is true
-string File_token_stream::find_term(bool throw_if_not_found)
+const string& File_token_stream::find_term(bool throw_if_not_found)
 {
-	string token = find_token(throw_if_not_found);
+	const string& token = find_token(throw_if_not_found);
 	if(token == "(" || token == ")")
 		throw PPS_parser_exception(*this, "Expected a term, not a '(' or ')'");
 	return token;
@@ -845,9 +900,6 @@ string File_token_stream::find_term(bool throw_if_not_found)
 // Count the parentheses for use by error recovery.
 bool File_token_stream::isolate_token()
 {
-	const string whitespace(" \n\r\t");
-	const string terminators(" ()\n\r\t");
-	
 	if (current_pos == string::npos) {
 		current_token.clear();
 		return false;	// no more tokens on the line
@@ -858,10 +910,13 @@ bool File_token_stream::isolate_token()
 		return true;
 		}
 	// time to find a new token
+	const char * line = contents.data() + line_start;
 	// skip any leading spaces
-	current_pos = line.find_first_not_of(whitespace, current_pos);
+	while (current_pos < line_length && is_whitespace(line[current_pos]))
+		current_pos++;
 	
-	if (current_pos == string::npos) {
+	if (current_pos >= line_length) {
+		current_pos = string::npos;
 		current_token.clear();
 		return false;	// no more tokens on the line
 		}
@@ -874,7 +929,7 @@ bool File_token_stream::isolate_token()
 			current_token.clear();
 			return false;	// no more tokens on this line
 		case '/': 
-			if (current_pos + 1 <= line.size() && line[current_pos + 1] == '/') {
+			if (current_pos + 1 < line_length && line[current_pos + 1] == '/') {
 				current_token.clear();
 				return false;	// no more tokens on this line
 				}
@@ -892,21 +947,14 @@ bool File_token_stream::isolate_token()
 		default:
 			break;
 		}
-	// otherwise, find the end of the token - terminated by end of string also
-	size_t end_pos = line.find_first_of(terminators, current_pos);
-	// calculate length, and next starting position
-	size_t length;
-	if (end_pos == string::npos) {
-		length = end_pos;
-		next_pos = string::npos;
-		}
-	else {
-		length = (end_pos - current_pos); // note unsigned arithmetic!
-		next_pos = end_pos;
-		}
-		
-	// the current token is the substring that starts at index and has length characters
-	current_token = line.substr(current_pos, length);
+	// otherwise, find the end of the token - terminated by end of line also
+	size_t end_pos = current_pos + 1;
+	while (end_pos < line_length && !is_terminator(line[end_pos]))
+		end_pos++;
+	// the current token is the characters from current_pos up to end_pos;
+	// assigning them re-uses the space already in current_token
+	current_token.assign(line + current_pos, end_pos - current_pos);
+	next_pos = (end_pos < line_length) ? end_pos : string::npos;
 //	PPS_out << token << ' ' << index << endl;
 	return true;
 }
@@ -919,12 +967,12 @@ bool File_token_stream::isolate_token()
 void File_token_stream::find_end_of_balanced_parentheses()
 {
 	// if the input file is bad, we probably hit EOF already; do nothing
-	if(!input_file)
+	if(past_end)
 		return;
 	// get past the current token
 	advance();
 	// now gobble as long as you find something until no more open parentheses left
-	while(parentheses_count > 0 && find_token(false) != string()) {
+	while(parentheses_count > 0 && !find_token(false).empty()) {
 		advance();
 		}
 //	display_status();
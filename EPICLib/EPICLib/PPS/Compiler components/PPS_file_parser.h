@@ -16,15 +16,16 @@
 
 namespace Parsimonious_Production_System {
 
+// File_token_stream reads the whole file into memory at once, and then isolates the tokens
+// line by line from that copy; the line and position are kept for error messages.
 class File_token_stream {
 public:
 		
-	File_token_stream(std::ifstream& ifs) :
-		input_file(ifs), current_pos(0),next_pos(0), line_number(0), parentheses_count(0)
-		{load_token_info();}
+	File_token_stream(std::ifstream& ifs);
 		
-	std::string find_token(bool throw_if_not_found = true);
-	std::string find_term(bool throw_if_not_found = true);
+	// the returned token remains valid until the next call
+	const std::string& find_token(bool throw_if_not_found = true);
+	const std::string& find_term(bool throw_if_not_found = true);
 	
 	void advance()
 		{current_pos = next_pos;}
@@ -40,17 +41,22 @@ public:
 	void display_status() const;
 
 private:
-	std::ifstream& input_file;
+	std::string contents;
+	std::size_t line_start;			// where the current line is in contents
+	std::size_t line_length;		// not including the newline
+	std::size_t next_line_start;
+	bool past_end;					// set when there is no line left to read, as the file stream would be
 	std::string current_token;
-	std::size_t current_pos;
+	std::size_t current_pos;		// current_pos and next_pos are relative to the line start
 	std::size_t next_pos;
 	int line_number;
-	std::string line;
 	int parentheses_count;	// counts number of '(' - number of ')' found so far
 	
 	void load_token_info();
 	std::map<std::string, std::string> token_info;	// loaded in constructor
 
+	void read_contents(std::ifstream& ifs);
+	bool get_next_line();
 //	bool isolate_token(std::string& token);
 	bool isolate_token();
 
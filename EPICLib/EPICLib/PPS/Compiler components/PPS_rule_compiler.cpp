@@ -263,22 +263,27 @@ void replace_pos_neg_pair(Compiler_rule_data_list_t& rule_data_list, const Compi
 	// remove the max_pair terms from the patterns and replace with a dummy pattern 
 	for(Compiler_rule_data_list_t::iterator rule_it = rule_data_list.begin(); rule_it != rule_data_list.end(); rule_it++) {
 		// replace in positive patterns, remove from negated patterns
-		Compiler_node_data_list_t::const_iterator found_it1 = find((*rule_it).pos_node_data_list.begin(), (*rule_it).pos_node_data_list.end(), org_pair.first);
-		// might be a faster way to do this
-		if (found_it1 == (*rule_it).pos_node_data_list.end()) 
-			continue;
-		Compiler_node_data_list_t::const_iterator found_it2 = find((*rule_it).neg_node_data_list.begin(), (*rule_it).neg_node_data_list.end(), org_pair.second);
-		if (found_it2 == (*rule_it).neg_node_data_list.end()) 
-			continue;
-		// remove them
-		(*rule_it).pos_node_data_list.remove(org_pair.first);
-		(*rule_it).neg_node_data_list.remove(org_pair.second);
-		// add a replacement pattern at the end of the positive list
-		(*rule_it).pos_node_data_list.push_back(replacement);
-		
+		replace_pos_neg_pair_in_lists((*rule_it).pos_node_data_list, (*rule_it).neg_node_data_list, org_pair, replacement);
 		}
 }
 
+void replace_pos_neg_pair_in_lists(Compiler_node_data_list_t& pos_node_data_list, Compiler_node_data_list_t& neg_node_data_list,
+	const Compiler_node_data_pair& org_pair, const Compiler_node_data& replacement)
+{
+	Compiler_node_data_list_t::const_iterator found_it1 = find(pos_node_data_list.begin(), pos_node_data_list.end(), org_pair.first);
+	// might be a faster way to do this
+	if (found_it1 == pos_node_data_list.end()) 
+		return;
+	Compiler_node_data_list_t::const_iterator found_it2 = find(neg_node_data_list.begin(), neg_node_data_list.end(), org_pair.second);
+	if (found_it2 == neg_node_data_list.end()) 
+		return;
+	// remove them
+	pos_node_data_list.remove(org_pair.first);
+	neg_node_data_list.remove(org_pair.second);
+	// add a replacement pattern at the end of the positive list
+	pos_node_data_list.push_back(replacement);
+}
+
 void print_rule_data_list(const Compiler_rule_data_list_t& rule_data_list)
 {
 	if(!PPS_out)
@@ -25,6 +25,8 @@ void replace_pair(Compiler_rule_data_list_t& rule_patterns, const Compiler_node_
 void make_neg_node_data_list(Compiler_rule_data_list_t& rule_data_list);
 void replace_pos_neg_pair(Compiler_rule_data_list_t& rule_data_list, const Compiler_node_data_pair& max_pair, 
 	const Compiler_node_data& replacement);
+void replace_pos_neg_pair_in_lists(Compiler_node_data_list_t& pos_node_data_list, Compiler_node_data_list_t& neg_node_data_list,
+	const Compiler_node_data_pair& org_pair, const Compiler_node_data& replacement);
 void combine_rules(Production_System * production_system_ptr, Compiler_rule_data_list_t& rule_data_list);
 int get_two_predicate_args(const Symbol_list_t& predicate_pattern, Symbol& arg1, Symbol& arg2);
 
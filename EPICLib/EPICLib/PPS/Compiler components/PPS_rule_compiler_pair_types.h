@@ -12,6 +12,11 @@
 //#include <string>
 //#include <list>
 #include <map>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
 #include <typeinfo>
 
 namespace Parsimonious_Production_System {
@@ -326,6 +331,192 @@ struct No_Overlap_Negation_Node_pair
 
 
 
+template <class PT>
+void generate_pairs(PT pair_type, const Compiler_node_data_list_t& node_data_list, Compiler_node_data_pair_counter_map_t& pair_counts)
+{
+	for (Compiler_node_data_list_t::const_iterator it2 = node_data_list.begin(); it2 != node_data_list.end(); it2++) {
+		Compiler_node_data_list_t::const_iterator it3 = it2;
+		it3++;
+		Compiler_node_data_pair new_pair;
+		
+		for (; it3 != node_data_list.end(); it3++) {
+			if (pair_type.make_valid_pair((*it2), (*it3), new_pair)) {
+//				 new_pair.display();
+//				 PPS_out << endl;
+				
+				pair_counts[new_pair]++;
+				}
+
+			}
+		}
+}
+
+// form pairs by taking the one item out of the positive list and combining it with each item in the negated list
+template <class PT>
+void generate_pos_neg_pairs(PT pair_type, const Compiler_node_data_list_t& pos_node_data_list, const Compiler_node_data_list_t& neg_node_data_list, Compiler_node_data_pair_counter_map_t& pair_counts)
+{
+	for (Compiler_node_data_list_t::const_iterator it2 = pos_node_data_list.begin(); it2 != pos_node_data_list.end(); it2++) {
+
+		Compiler_node_data_pair new_pair;
+		for (Compiler_node_data_list_t::const_iterator it3 = neg_node_data_list.begin(); it3 != neg_node_data_list.end(); it3++) {
+			if (pair_type.make_valid_pair((*it2), (*it3), new_pair)) {
+				 // new_pair.display();
+				 // PPS_out << endl;
+				
+				pair_counts[new_pair]++;
+				}
+
+			}
+		}
+}
+
+/*
+Pair_counts holds the counts of the valid pairs over all of the node data lists for one pair type,
+and keeps them up to date as pairs are replaced, so that each pass of combine does not have to
+regenerate the pairs for the whole rule set. The lists are held in units: either a single list whose
+items are paired with each other, or a positive and a negated list whose items are paired across.
+When a pair is replaced, only the units that contain it are touched: their old pairs are subtracted
+from the counts and their new pairs added. The counts are also kept in order by count, and the most
+frequent pair is the first in pair order among those with the highest count, which is the pair that
+a scan of regenerated counts would choose, so the network is the same as before.
+*/
+template <class PT>
+class Pair_counts {
+public:
+	Pair_counts(PT pair_type_) :
+		pair_type(pair_type_)
+		{}
+
+	// the items in the list are paired with each other
+	void add_unit(Compiler_node_data_list_t& node_data_list)
+		{add_unit(Unit(&node_data_list, 0));}
+	// the items in the positive list are paired with the items in the negated list
+	void add_unit(Compiler_node_data_list_t& pos_node_data_list, Compiler_node_data_list_t& neg_node_data_list)
+		{add_unit(Unit(&pos_node_data_list, &neg_node_data_list));}
+
+	// set max_pair and max_count to the most frequent pair; max_count is zero if there are no pairs
+	void find_most_frequent_pair(Compiler_node_data_pair& max_pair, int& max_count) const
+	{
+		if(pairs_by_count.empty()) {
+			max_count = 0;
+			return;
+			}
+		Pair_count_it_t it = *pairs_by_count.begin();
+		max_pair = it->first;
+		max_count = it->second.count;
+	}
+
+	// replace the pair in each unit that contains it, and update the counts
+	void replace_pair(const Compiler_node_data_pair& org_pair, const Compiler_node_data& replacement)
+	{
+		// only the units that contain the less frequent node need to be examined
+		const Unit_index_list_t& first_units = units_by_node[org_pair.first.node_ptr];
+		const Unit_index_list_t& second_units = units_by_node[org_pair.second.node_ptr];
+		Unit_index_list_t candidates = (first_units.size() < second_units.size()) ? first_units : second_units;
+		for(Unit_index_list_t::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+			Unit& unit = units[*it];
+			if(!unit.contains(org_pair))
+				continue;
+			Compiler_node_data_pair_counter_map_t unit_counts;
+			generate_unit_pairs(unit, unit_counts);
+			change_counts(unit_counts, -1);
+			unit.replace(org_pair, replacement);
+			index_node(replacement, *it);
+			unit_counts.clear();
+			generate_unit_pairs(unit, unit_counts);
+			change_counts(unit_counts, 1);
+			}
+	}
+
+private:
+	// second_list is zero if the items of first_list are paired with each other
+	struct Unit {
+		Unit(Compiler_node_data_list_t * first_list_, Compiler_node_data_list_t * second_list_) :
+			first_list(first_list_), second_list(second_list_)
+			{}
+		bool contains(const Compiler_node_data_pair& node_data_pair) const
+		{
+			Compiler_node_data_list_t& list_with_second = (second_list) ? *second_list : *first_list;
+			return std::find(first_list->begin(), first_list->end(), node_data_pair.first) != first_list->end() &&
+				std::find(list_with_second.begin(), list_with_second.end(), node_data_pair.second) != list_with_second.end();
+		}
+		void replace(const Compiler_node_data_pair& node_data_pair, const Compiler_node_data& replacement)
+		{
+			if(second_list)
+				replace_pos_neg_pair_in_lists(*first_list, *second_list, node_data_pair, replacement);
+			else
+				replace_pair_in_list(*first_list, node_data_pair, replacement);
+		}
+		Compiler_node_data_list_t * first_list;
+		Compiler_node_data_list_t * second_list;
+	};
+
+	typedef std::vector<std::size_t> Unit_index_list_t;
+	typedef Compiler_node_data_pair_counter_map_t::iterator Pair_count_it_t;
+	// higher counts first, then the pair order of the count map
+	struct Higher_count {
+		bool operator() (Pair_count_it_t lhs, Pair_count_it_t rhs) const
+		{
+			if(lhs->second.count != rhs->second.count)
+				return lhs->second.count > rhs->second.count;
+			return lhs->first < rhs->first;
+		}
+	};
+
+	PT pair_type;
+	std::vector<Unit> units;
+	std::map<const Combining_Node *, Unit_index_list_t> units_by_node;
+	Compiler_node_data_pair_counter_map_t pair_counts;	// holds only non-zero counts
+	std::set<Pair_count_it_t, Higher_count> pairs_by_count;
+
+	void add_unit(const Unit& unit)
+	{
+		std::size_t unit_index = units.size();
+		units.push_back(unit);
+		for(Compiler_node_data_list_t::const_iterator it = unit.first_list->begin(); it != unit.first_list->end(); ++it)
+			index_node(*it, unit_index);
+		if(unit.second_list)
+			for(Compiler_node_data_list_t::const_iterator it = unit.second_list->begin(); it != unit.second_list->end(); ++it)
+				index_node(*it, unit_index);
+		Compiler_node_data_pair_counter_map_t unit_counts;
+		generate_unit_pairs(unit, unit_counts);
+		change_counts(unit_counts, 1);
+	}
+
+	// units are indexed in order, so a repeated node in a unit is seen consecutively
+	void index_node(const Compiler_node_data& node_data, std::size_t unit_index)
+	{
+		Unit_index_list_t& unit_indices = units_by_node[node_data.node_ptr];
+		if(unit_indices.empty() || unit_indices.back() != unit_index)
+			unit_indices.push_back(unit_index);
+	}
+
+	void generate_unit_pairs(const Unit& unit, Compiler_node_data_pair_counter_map_t& unit_counts)
+	{
+		if(unit.second_list)
+			generate_pos_neg_pairs(pair_type, *unit.first_list, *unit.second_list, unit_counts);
+		else
+			generate_pairs(pair_type, *unit.first_list, unit_counts);
+	}
+
+	// add or subtract the counts for a unit, keeping the index by count consistent
+	void change_counts(const Compiler_node_data_pair_counter_map_t& unit_counts, int sign)
+	{
+		for(Compiler_node_data_pair_counter_map_t::const_iterator it = unit_counts.begin(); it != unit_counts.end(); ++it) {
+			Pair_count_it_t count_it = pair_counts.find(it->first);
+			if(count_it == pair_counts.end())
+				count_it = pair_counts.insert(std::make_pair(it->first, Counter())).first;
+			else
+				pairs_by_count.erase(count_it);
+			count_it->second.count += sign * it->second.count;
+			if(count_it->second.count > 0)
+				pairs_by_count.insert(count_it);
+			else
+				pair_counts.erase(count_it);
+			}
+	}
+};
+
 template <class PT>
 void combine(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bool output)
 {
@@ -333,12 +524,23 @@ void combine(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bool outpu
 	int max_count = 0;
 	if(output)
 		PPS_out << "\n" << typeid(pair_type).name() << std::endl;
+
+	// count the pairs in each rule condition once; each pass updates only the rules it changes
+	Pair_counts<PT> pair_counts(pair_type);
+	for(Compiler_rule_data_list_t::iterator rule_it = rule_data_list.begin(); 
+		rule_it != rule_data_list.end(); rule_it++) {
+		pair_counts.add_unit((*rule_it).pos_node_data_list);
+		for(list_Compiler_node_data_list_t::iterator neg_it = (*rule_it).neg_node_data_lists.begin(); neg_it != (*rule_it).neg_node_data_lists.end(); neg_it++)
+			pair_counts.add_unit(*neg_it);
+		for(list_Compiler_node_data_list_t::iterator neg_it = (*rule_it).neg_conjunction_node_data_lists.begin(); neg_it != (*rule_it).neg_conjunction_node_data_lists.end(); neg_it++)
+			pair_counts.add_unit(*neg_it);
+		}
+
 	while (true) {
 		Compiler_node_data_pair max_pair;
 		max_count = 0;
 		
-		// this version of find max pair finds simple pairs (no variables)
-		find_most_frequent_pair(pair_type, rule_data_list, max_pair, max_count);
+		pair_counts.find_most_frequent_pair(max_pair, max_count);
 		
 		// when max_count is 1, a shortcut would be possible because
 		// all pairs left are unique. 
@@ -367,7 +569,7 @@ void combine(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bool outpu
 //		new_node_data.node_ptr->display_contents();
 			}
 			
-		replace_pair(rule_data_list, max_pair, new_node_data);
+		pair_counts.replace_pair(max_pair, new_node_data);
 
 		// output the list
 //		print_data_list(rule_data_list);
@@ -377,72 +579,6 @@ void combine(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bool outpu
 //	print_rule_data_list(rule_data_list);
 }
 
-// find the most frequent pair
-template <class PT>
-void find_most_frequent_pair(PT pair_type, const Compiler_rule_data_list_t& rule_data_list, Compiler_node_data_pair& max_pair, int& max_count)
-{
-	
-	Compiler_node_data_pair_counter_map_t pair_counts;
-
-	// generate the pairs in each rule condition and put into a sorted container
-	for(Compiler_rule_data_list_t::const_iterator rule_it = rule_data_list.begin(); 
-		rule_it != rule_data_list.end(); rule_it++) {
-//		PPS_out << endl;
-		// generate pairs for positive patterns
-		generate_pairs(pair_type, (*rule_it).pos_node_data_list, pair_counts);
-		// generate all the pairs for the negative patterns
-		for(list_Compiler_node_data_list_t::const_iterator neg_it = (*rule_it).neg_node_data_lists.begin(); neg_it != (*rule_it).neg_node_data_lists.end(); neg_it++) {
-				generate_pairs(pair_type, (*neg_it), pair_counts);
-			}
-		for(list_Compiler_node_data_list_t::const_iterator neg_it = (*rule_it).neg_conjunction_node_data_lists.begin(); neg_it != (*rule_it).neg_conjunction_node_data_lists.end(); neg_it++) {
-				generate_pairs(pair_type, (*neg_it), pair_counts);
-			}
-		
-		}
-
-	// find the largest count pattern
-	// output the counts
-	
-	for(Compiler_node_data_pair_counter_map_t::iterator it = pair_counts.begin(); it != pair_counts.end(); it++) {
-//		 PPS_out << (*it).second.count << " ";
-//		 (*it).first.display();
-//		 PPS_out << endl;
-		
-		if ((*it).second.count > max_count) {
-			max_count = (*it).second.count;
-			max_pair = (*it).first;
-			}
-		}
-
-//	if (max_count > 0) {
-//		PPS_out << "Most frequent pair count: " << max_count << " pair is: " << endl;
-//		max_pair.display();
-//		PPS_out << endl;
-//		}
-	return;
-}
-
-
-template <class PT>
-void generate_pairs(PT pair_type, const Compiler_node_data_list_t& node_data_list, Compiler_node_data_pair_counter_map_t& pair_counts)
-{
-	for (Compiler_node_data_list_t::const_iterator it2 = node_data_list.begin(); it2 != node_data_list.end(); it2++) {
-		Compiler_node_data_list_t::const_iterator it3 = it2;
-		it3++;
-		Compiler_node_data_pair new_pair;
-		
-		for (; it3 != node_data_list.end(); it3++) {
-			if (pair_type.make_valid_pair((*it2), (*it3), new_pair)) {
-//				 new_pair.display();
-//				 PPS_out << endl;
-				
-				pair_counts[new_pair]++;
-				}
-
-			}
-		}
-}
-
 // for each combination of pos & neg nodes
 template <class PT>
 void combine_pos_neg(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bool output)
@@ -451,12 +587,19 @@ void combine_pos_neg(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bo
 	int max_count = 0;
 	if(output)
 		PPS_out << typeid(pair_type).name() << endl;
+
+	// count the pos & neg pairs in each rule once; each pass updates only the rules it changes
+	Pair_counts<PT> pair_counts(pair_type);
+	for(Compiler_rule_data_list_t::iterator rule_it = rule_data_list.begin(); 
+		rule_it != rule_data_list.end(); rule_it++) {
+		pair_counts.add_unit((*rule_it).pos_node_data_list, (*rule_it).neg_node_data_list);
+		}
+
 	while (true) {
 		Compiler_node_data_pair max_pair;
 		max_count = 0;
 		
-		// this version of find max pair finds simple pairs (no variables)
-		find_most_frequent_pos_neg_pair(pair_type, rule_data_list, max_pair, max_count);
+		pair_counts.find_most_frequent_pair(max_pair, max_count);
 		
 		// when max_count is 1, a shortcut would be possible because
 		// all pairs left are unique. 
@@ -485,7 +628,7 @@ void combine_pos_neg(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bo
 	//		new_node_data.node_ptr->display_contents();
 			}
 			
-		replace_pos_neg_pair(rule_data_list, max_pair, new_node_data);
+		pair_counts.replace_pair(max_pair, new_node_data);
 
 		// output the list
 //		print_rule_data_list(rule_data_list);
@@ -495,63 +638,6 @@ void combine_pos_neg(PT pair_type, Compiler_rule_data_list_t& rule_data_list, bo
 //	print_rule_data_list(rule_data_list);
 }
 
-
-
-
-// find the most frequent pair
-template <class PT>
-void find_most_frequent_pos_neg_pair(PT pair_type, const Compiler_rule_data_list_t& rule_data_list, Compiler_node_data_pair& max_pair, int& max_count)
-{
-	
-	Compiler_node_data_pair_counter_map_t pair_counts;
-
-	// generate the pairs in each rule condition and put into a sorted container
-	for(Compiler_rule_data_list_t::const_iterator rule_it = rule_data_list.begin(); 
-		rule_it != rule_data_list.end(); rule_it++) {
-		generate_pos_neg_pairs(pair_type, (*rule_it).pos_node_data_list, (*rule_it).neg_node_data_list, pair_counts);		
-		}
-
-	// find the largest count pattern
-	// output the counts
-	
-	for(Compiler_node_data_pair_counter_map_t::iterator it = pair_counts.begin(); it != pair_counts.end(); it++) {
-//		 PPS_out << (*it).second.count << " ";
-//		 (*it).first.display();
-//		 PPS_out << endl;
-		
-		if ((*it).second.count > max_count) {
-			max_count = (*it).second.count;
-			max_pair = (*it).first;
-			}
-		}
-
-//	if (max_count > 0) {
-//		PPS_out << "Most frequent pos_neg_pair count: " << max_count << " pair is: " << endl;
-//		max_pair.display();
-//		PPS_out << endl;
-//		}
-	return;
-}
-
-// form pairs by taking the one item out of the positive list and combining it with each item in the negated list
-template <class PT>
-void generate_pos_neg_pairs(PT pair_type, const Compiler_node_data_list_t& pos_node_data_list, const Compiler_node_data_list_t& neg_node_data_list, Compiler_node_data_pair_counter_map_t& pair_counts)
-{
-	for (Compiler_node_data_list_t::const_iterator it2 = pos_node_data_list.begin(); it2 != pos_node_data_list.end(); it2++) {
-
-		Compiler_node_data_pair new_pair;
-		for (Compiler_node_data_list_t::const_iterator it3 = neg_node_data_list.begin(); it3 != neg_node_data_list.end(); it3++) {
-			if (pair_type.make_valid_pair((*it2), (*it3), new_pair)) {
-				 // new_pair.display();
-				 // PPS_out << endl;
-				
-				pair_counts[new_pair]++;
-				}
-
-			}
-		}
-}
-
 } // end namespace
 
 #endif
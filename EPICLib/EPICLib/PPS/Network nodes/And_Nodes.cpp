@@ -11,7 +11,7 @@ using std::cout; using std::endl;
 namespace Parsimonious_Production_System {
 
 
-bool And_Node::debug_flag = false;
+thread_local bool And_Node::debug_flag = false;
 
 // display for debugging purposes
 
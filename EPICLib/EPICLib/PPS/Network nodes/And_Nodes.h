@@ -17,7 +17,7 @@ public:
 		input_A(in_a), input_B(in_b)
 		{}
 
-	static bool debug_flag;
+	static thread_local bool debug_flag;
 
 protected:
 	Combining_Node * input_A;
@@ -7,9 +7,11 @@
 #include <iostream>
 #include <typeinfo>
 #include <string>
+#include <chrono>
 
 using std::cout; using std::endl; using std::cerr;
 using std::string;
+using std::chrono::steady_clock; using std::chrono::duration;
 //	using std::typeid;
 
 namespace Parsimonious_Production_System {
@@ -20,9 +22,13 @@ const Binding_set_list c_empty_binding_set_list;
 
 
 // define static member variables
-int Combining_Node::next_node_number = 0;
+thread_local int Combining_Node::next_node_number = 0;
 
-bool Combining_Node::debug_flag = false;
+thread_local bool Combining_Node::debug_flag = false;
+thread_local bool Combining_Node::profiling_flag = false;
+
+// time spent in the successors of the update currently being profiled in this thread
+static thread_local double profiled_successor_time = 0.;
 
 // display the contents of the node
 void Combining_Node::display_contents(const char * label, bool dynamic, int indent_level) const
@@ -70,6 +76,47 @@ void Bindings_Node::display_state(int indent_level) const
 }
 
 
+// the update is timed as a whole; the time spent in nested updates of successors
+// is subtracted to get the self time, and added to the time of the caller's successors
+bool Combining_Node::profiled_update(bool positive, const Combining_Node * source_node, const Binding_set * bs_ptr)
+{
+	if(positive)
+		profile.positive_updates++;
+	else
+		profile.negative_updates++;
+
+	double saved_successor_time = profiled_successor_time;
+	profiled_successor_time = 0.;
+	steady_clock::time_point start = steady_clock::now();
+
+	bool result;
+	if(bs_ptr)
+		result = (positive) ? add_clause(*bs_ptr) : remove_clause(*bs_ptr);
+	else
+		result = (positive) ? positive_update(source_node) : negative_update(source_node);
+
+	double elapsed = duration<double>(steady_clock::now() - start).count();
+	profile.total_time += elapsed;
+	profile.self_time += elapsed - profiled_successor_time;
+	profiled_successor_time = saved_successor_time + elapsed;
+	return result;
+}
+
+void Combining_Node::profiled_propagate(bool positive) const
+{
+	profile.binding_sets_produced += get_delta_binding_set_count();
+	for (Combining_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++)
+		(*it)->profiled_update(positive, this, 0);
+}
+
+void Combining_Node::display_profile() const
+{
+	PPS_out << clean_typeid_name() << ' ' << id << ": " 
+		<< profile.positive_updates << " positive, " << profile.negative_updates << " negative updates, "
+		<< profile.binding_sets_produced << " binding sets produced, "
+		<< profile.self_time << " sec self, " << profile.total_time << " sec total" << endl;
+}
+
 // Fat Interface for all possible subclasses of Combining_Node
 // There are dummy definitions of these to catch erroneous calls
 
@@ -22,6 +22,20 @@ struct less_Combining_Node_ptr;
 typedef std::set<Combining_Node *, less_Combining_Node_ptr> Combining_Node_ptr_set_t;
 typedef std::list<Combining_Node *> Combining_Node_ptr_list_t;
 
+// Profile data accumulated by a Combining_Node while profiling is enabled.
+// Times are in seconds; total_time includes the time spent in successor nodes, self_time does not.
+struct Combining_Node_profile {
+	Combining_Node_profile() :
+		positive_updates(0), negative_updates(0), binding_sets_produced(0),
+		total_time(0.), self_time(0.)
+		{}
+	long positive_updates;			// positive updates or added clauses received
+	long negative_updates;			// negative updates or removed clauses received
+	long binding_sets_produced;		// delta binding sets propagated to successors
+	double total_time;
+	double self_time;
+};
+
 // A Combining_Node has a name, state, and sucessors
 // This is an abstract class; positive/negative update functions must be overridden
 
@@ -77,7 +91,24 @@ public:
 	// execute the rule actions - implemented by Rule_Nodes
 //	virtual void execute(Command_interface&) const;
 
-	static bool debug_flag;
+	// called by the discrimination net to add or remove a clause at a Pattern_Node;
+	// the update is counted and timed if profiling is on
+	bool receive_add_clause(const Binding_set& bs)
+		{return (profiling_flag) ? profiled_update(true, 0, &bs) : add_clause(bs);}
+	bool receive_remove_clause(const Binding_set& bs)
+		{return (profiling_flag) ? profiled_update(false, 0, &bs) : remove_clause(bs);}
+
+	// access and reset the profile data
+	const Combining_Node_profile& get_profile() const
+		{return profile;}
+	void clear_profile()
+		{profile = Combining_Node_profile();}
+	// display the profile data on one line
+	void display_profile() const;
+
+	static thread_local bool debug_flag;
+	// if true, updates are counted and timed in each node's profile
+	static thread_local bool profiling_flag;
 	
 	static int get_next_node_number()
 		{return next_node_number++;}
@@ -100,6 +131,11 @@ protected:
 			display_state();
 			}
 
+		if (profiling_flag) {
+			profiled_propagate(true);
+			return;
+			}
+
 		// update successors
 		for (Combining_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++)
 			(*it)->positive_update(this);
@@ -112,6 +148,11 @@ protected:
 			display_state();
 			}
 
+		if (profiling_flag) {
+			profiled_propagate(false);
+			return;
+			}
+
 		// update successors
 		for (Combining_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++)
 			(*it)->negative_update(this);
@@ -128,9 +169,19 @@ protected:
 	// return a string containing this nodes type name, without any qualifiers
 	std::string clean_typeid_name() const;
 
+	// the number of delta binding sets being propagated, for profiling
+	virtual long get_delta_binding_set_count() const
+		{return 0;}
+
 	
 private:
-	static int next_node_number;
+	static thread_local int next_node_number;
+	mutable Combining_Node_profile profile;
+
+	// apply an update or clause to this node, accumulating profile data
+	bool profiled_update(bool positive, const Combining_Node * source_node, const Binding_set * bs_ptr);
+	// propagate to the successors, accumulating profile data
+	void profiled_propagate(bool positive) const;
 
 	Combining_Node_ptr_list_t successors;				// nodes for changes to be propagated to
 	Combining_Node(Combining_Node&);
@@ -171,6 +222,9 @@ public:
 protected:
 	Binding_set_list binding_sets;			// current bindings for this node
 	Binding_set_list delta_binding_sets;	// current delta bindings to be propagated
+
+	virtual long get_delta_binding_set_count() const
+		{return long(delta_binding_sets.get_binding_set_list().size());}
 	
 private:
 	Bindings_Node& operator= (Bindings_Node&);
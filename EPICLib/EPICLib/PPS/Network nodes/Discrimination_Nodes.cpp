@@ -61,15 +61,7 @@ bool Root_Node::start_add_clause(const Clause& clause) const
 		}
 		
 	Binding_set bindings;
-	bool return_status = false;
-	Clause_state saved_state = clause.get_state(); // somehow omitted earlier - DK, 2/4/04
-
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		clause.set_state(saved_state); // somehow omitted earlier - DK, 2/4/04
-		return_status = (*it)->add_clause(clause, bindings) || return_status;
-		}
-
-	return return_status;
+	return add_clause_to_successors(clause, bindings);
 }
 
 bool Root_Node::start_remove_clause(const Clause& clause) const
@@ -82,19 +74,94 @@ bool Root_Node::start_remove_clause(const Clause& clause) const
 		}
 		
 	Binding_set bindings;
-	bool return_status = false;
-	Clause_state saved_state = clause.get_state(); // somehow omitted earlier - DK, 2/4/04
+	return remove_clause_from_successors(clause, bindings);
+}
 
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		clause.set_state(saved_state); // somehow omitted earlier - DK, 2/4/04
-		return_status = (*it)->remove_clause(clause, bindings) || return_status;
+
+thread_local bool Discrimination_Node::debug_flag = false;
+
+void Discrimination_Node::add_successor(Discrimination_Node * p)
+{
+	Ordered_successor_t ordered_successor(int(successors.size()), p);
+	successors.push_back(p);
+	if(p->is_constant())
+		constant_successors[p->term] = ordered_successor;
+	else
+		variable_successors.push_back(ordered_successor);
+}
+
+Discrimination_Node * Discrimination_Node::find_successor(const Symbol& in_term) const
+{
+	Ordered_successor_map_t::const_iterator map_it = constant_successors.find(in_term);
+	if(map_it != constant_successors.end())
+		return map_it->second.second;
+	for (Ordered_successor_list_t::const_iterator it = variable_successors.begin(); it != variable_successors.end(); it++) {
+		if (it->second->term == in_term)
+			return it->second;
+		}
+	return 0;
+}
+
+const Ordered_successor_t * Discrimination_Node::find_constant_successor(const Clause& clause) const
+{
+	if(clause.at_end())
+		return 0;
+	Ordered_successor_map_t::const_iterator map_it = constant_successors.find(clause.get_current_term());
+	if(map_it == constant_successors.end())
+		return 0;
+	return &(map_it->second);
+}
+
+// save the state, and call the constant successor for the current term, if any, and each
+// variable successor with the current state, in the order they were created;
+// return true if a true comes back
+bool Discrimination_Node::add_clause_to_successors(const Clause& clause, const Binding_set& binding_set) const
+{
+	Clause_state saved_state = clause.get_state();
+	bool return_status = false;
+	
+	// the constant successor is called in its place among the variable successors
+	const Ordered_successor_t * constant_ptr = find_constant_successor(clause);
+	for (Ordered_successor_list_t::const_iterator it = variable_successors.begin(); it != variable_successors.end(); it++) {
+		if(constant_ptr && constant_ptr->first < it->first) {
+			clause.set_state(saved_state);
+			return_status = constant_ptr->second->add_clause(clause, binding_set) || return_status;
+			constant_ptr = 0;
+			}
+		clause.set_state(saved_state);
+		return_status = it->second->add_clause(clause, binding_set) || return_status;
+		}
+	if(constant_ptr) {
+		clause.set_state(saved_state);
+		return_status = constant_ptr->second->add_clause(clause, binding_set) || return_status;
 		}
 
 	return return_status;
 }
 
+bool Discrimination_Node::remove_clause_from_successors(const Clause& clause, const Binding_set& binding_set) const
+{
+	Clause_state saved_state = clause.get_state();
+	bool return_status = false;
+	
+	// the constant successor is called in its place among the variable successors
+	const Ordered_successor_t * constant_ptr = find_constant_successor(clause);
+	for (Ordered_successor_list_t::const_iterator it = variable_successors.begin(); it != variable_successors.end(); it++) {
+		if(constant_ptr && constant_ptr->first < it->first) {
+			clause.set_state(saved_state);
+			return_status = constant_ptr->second->remove_clause(clause, binding_set) || return_status;
+			constant_ptr = 0;
+			}
+		clause.set_state(saved_state);
+		return_status = it->second->remove_clause(clause, binding_set) || return_status;
+		}
+	if(constant_ptr) {
+		clause.set_state(saved_state);
+		return_status = constant_ptr->second->remove_clause(clause, binding_set) || return_status;
+		}
 
-bool Discrimination_Node::debug_flag = false;
+	return return_status;
+}
 
 bool Discrimination_Node::add_clause(const Clause&, const Binding_set&) const
 		{return false;}
@@ -156,13 +223,7 @@ Combining_Node * Discrimination_Node::build_pattern(
 	wildcard_number++;	// always advance the wildcard number
 	
 	// find the successor, if any, that matches this term; build it if it doesn't exist;
-	Discrimination_Node * successor = 0;
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		if ((*it)->term == current_term) {
-			successor = (*it);
-			break;
-			}
-		}
+	Discrimination_Node * successor = find_successor(current_term);
 
 	if(!successor) {
 		successor = create(current_term);
@@ -259,7 +320,7 @@ bool Constant_Discrimination_Node::add_clause(const Clause& clause, const Bindin
 	// if we are at a pattern node, and at the clause end, add the binding set to that node and return true
 	// (modified dk 8/4/04)
 	if (clause.at_end() && pattern_node_ptr) {
-		pattern_node_ptr->add_clause(binding_set);
+		pattern_node_ptr->receive_add_clause(binding_set);
 		return true;
 		}
 	
@@ -267,15 +328,7 @@ bool Constant_Discrimination_Node::add_clause(const Clause& clause, const Bindin
 	// save the state, and call each successor with the current state; 
 	// return true if a true comes back
 	
-	Clause_state saved_state = clause.get_state();
-	bool return_status = false;
-	
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		clause.set_state(saved_state);
-		return_status = (*it)->add_clause(clause, binding_set) || return_status;
-		}
-
-	return return_status;
+	return add_clause_to_successors(clause, binding_set);
 }
 
 bool Constant_Discrimination_Node::remove_clause(const Clause& clause, const Binding_set& binding_set) const
@@ -303,7 +356,7 @@ bool Constant_Discrimination_Node::remove_clause(const Clause& clause, const Bin
 	// if we are at a pattern node, and at the clause end, add the binding set to that node and return true
 	// (modified dk 8/4/04)
 	if (clause.at_end() && pattern_node_ptr) {
-		pattern_node_ptr->remove_clause(binding_set);
+		pattern_node_ptr->receive_remove_clause(binding_set);
 		return true;
 		}
 	
@@ -311,15 +364,7 @@ bool Constant_Discrimination_Node::remove_clause(const Clause& clause, const Bin
 	// save the state, and call each successor with the current state; 
 	// return true if a true comes back
 	
-	Clause_state saved_state = clause.get_state();
-	bool return_status = false;
-	
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		clause.set_state(saved_state);
-		return_status = (*it)->remove_clause(clause, binding_set) || return_status;
-		}
-
-	return return_status;
+	return remove_clause_from_successors(clause, binding_set);
 }
 
 bool Variable_Discrimination_Node::add_clause(const Clause& clause, const Binding_set& current_binding_set) const
@@ -352,7 +397,7 @@ bool Variable_Discrimination_Node::add_clause(const Clause& clause, const Bindin
 	// if we are at a pattern node, and at the clause end, add the binding set to that node and return true
 	// (modified dk 8/4/04)
 	if (clause.at_end() && pattern_node_ptr) {
-		pattern_node_ptr->add_clause(binding_set);
+		pattern_node_ptr->receive_add_clause(binding_set);
 		return true;
 		}
 	
@@ -360,15 +405,7 @@ bool Variable_Discrimination_Node::add_clause(const Clause& clause, const Bindin
 	// save the state, and call each successor with the current state; 
 	// return true if a true comes back
 	
-	Clause_state saved_state = clause.get_state();
-	bool return_status = false;
-	
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		clause.set_state(saved_state);
-		return_status = (*it)->add_clause(clause, binding_set) || return_status;
-		}
-
-	return return_status;
+	return add_clause_to_successors(clause, binding_set);
 }
 
 bool Variable_Discrimination_Node::remove_clause(const Clause& clause, const Binding_set& current_binding_set) const
@@ -401,7 +438,7 @@ bool Variable_Discrimination_Node::remove_clause(const Clause& clause, const Bin
 	// if we are at a pattern node, and at the clause end, add the binding set to that node and return true
 	// (modified dk 8/4/04)
 	if (clause.at_end() && pattern_node_ptr) {
-		pattern_node_ptr->remove_clause(binding_set);
+		pattern_node_ptr->receive_remove_clause(binding_set);
 		return true;
 		}
 	
@@ -409,15 +446,7 @@ bool Variable_Discrimination_Node::remove_clause(const Clause& clause, const Bin
 	// save the state, and call each successor with the current state; 
 	// return true if a true comes back
 	
-	Clause_state saved_state = clause.get_state();
-	bool return_status = false;
-	
-	for (Discrimination_Node_ptr_list_t::const_iterator it = successors.begin(); it != successors.end(); it++) {
-		clause.set_state(saved_state);
-		return_status = (*it)->remove_clause(clause, binding_set) || return_status;
-		}
-
-	return return_status;
+	return remove_clause_from_successors(clause, binding_set);
 }
 
 } // end namespace
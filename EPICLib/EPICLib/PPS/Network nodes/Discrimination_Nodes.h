@@ -20,7 +20,12 @@ for the clause node. If not, then add/remove_constant_clause is called instead.
 
 The discrimination function for the current term and discrimination node operates on 
 the current term. If it matches (or is a variable/wildcard node), then the term pointer
-is incremented and a recursive call is made to each successor.
+is incremented and a recursive call is made to each successor that could match the next term.
+The constant successors of a node are indexed by their terms, so only the one (if any) whose
+term is the next term of the clause is called; every variable/wildcard successor is called.
+The successors that are called are called in the order they were created, as they would be
+if every successor were tried in turn, because that order decides the order in which
+pattern nodes, and so rules, receive the clause.
 
 */
 
@@ -32,6 +37,9 @@ is incremented and a recursive call is made to each successor.
 
 #include <list>
 #include <set>
+#include <vector>
+#include <unordered_map>
+#include <utility>
 #include <string>
 //#include <iostream>
 
@@ -40,6 +48,10 @@ namespace Parsimonious_Production_System {
 class Discrimination_Node;
 typedef std::list<Discrimination_Node *> Discrimination_Node_ptr_list_t;
 typedef std::set<Discrimination_Node *> Discrimination_Node_ptr_set_t;
+// a successor with its position in the order of creation
+typedef std::pair<int, Discrimination_Node *> Ordered_successor_t;
+typedef std::unordered_map<Symbol, Ordered_successor_t, Symbol_hash> Ordered_successor_map_t;
+typedef std::vector<Ordered_successor_t> Ordered_successor_list_t;
 
 
 //forward declaration
@@ -56,8 +68,7 @@ public:
 
 	virtual ~Discrimination_Node() {}
 		
-	void add_successor(Discrimination_Node * p)
-		{successors.push_back(p);}
+	void add_successor(Discrimination_Node * p);
 
 	void set_pattern_node_ptr(Combining_Node * p)
 		{pattern_node_ptr = p;}
@@ -85,14 +96,28 @@ public:
 	static Discrimination_Node * create(const Symbol& current_term);
 	void display_contents(int indent_level) const;
 
-	static bool debug_flag;
+	// true if this node tests for its term being a specified value
+	virtual bool is_constant() const
+		{return false;}
+
+	static thread_local bool debug_flag;
 
 protected:
 	const Symbol term;
 	
-	Discrimination_Node_ptr_list_t successors;
+	Discrimination_Node_ptr_list_t successors;			// all successors, in order of creation
+	Ordered_successor_map_t constant_successors;		// constant successors by term
+	Ordered_successor_list_t variable_successors;		// variable and wildcard successors, in order
 	Combining_Node * pattern_node_ptr;	// pointer to clause node
 
+	// return the successor for the term, zero if there is none
+	Discrimination_Node * find_successor(const Symbol& in_term) const;
+	// return the constant successor for the current term of the clause, zero if there is none
+	const Ordered_successor_t * find_constant_successor(const Clause& clause) const;
+	// call add/remove_clause for each successor that could match the current term
+	bool add_clause_to_successors(const Clause& clause, const Binding_set& binding_set) const;
+	bool remove_clause_from_successors(const Clause& clause, const Binding_set& binding_set) const;
+
 //	Combining_Node * build_or_find_pattern(const Clause& pattern, Variable_list& var_names, 
 //		bool wildcard_present, int wildcard_number, bool build_flag);
 
@@ -136,6 +161,9 @@ public:
 	virtual bool add_clause(const Clause& clause, const Binding_set& binding_set) const;
 	virtual bool remove_clause(const Clause& clause, const Binding_set& binding_set) const;
 
+	virtual bool is_constant() const
+		{return true;}
+
 private:	
 	Constant_Discrimination_Node();
 };
@@ -11,7 +11,7 @@ using std::cout; using std::endl;
 
 namespace Parsimonious_Production_System {
 
-bool Negation_Node::debug_flag = false;
+thread_local bool Negation_Node::debug_flag = false;
 
 void Negation_Node::display_positive_update_from_positive() const
 {
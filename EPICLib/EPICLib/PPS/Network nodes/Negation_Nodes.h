@@ -18,7 +18,7 @@ public:
 		input_positive(in_pos), input_negative(in_neg)
 		{}
 
-	static bool debug_flag;
+	static thread_local bool debug_flag;
 
 protected:
 	Combining_Node * input_positive;
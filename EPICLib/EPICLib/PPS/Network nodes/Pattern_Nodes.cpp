@@ -12,7 +12,7 @@ using std::cout; using std::endl;
 namespace Parsimonious_Production_System {
 
 // ** Pattern Nodes ***
-bool Pattern_Node::debug_flag = false;
+thread_local bool Pattern_Node::debug_flag = false;
 
 Combining_Node * Pattern_Node::create(const Clause& pattern, const Variable_list& var_names, bool wildcard_present)
 {
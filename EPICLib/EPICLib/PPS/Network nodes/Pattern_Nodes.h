@@ -35,7 +35,7 @@ public:
 	
 	virtual ~Pattern_Node() {}
 	
-	static bool debug_flag;
+	static thread_local bool debug_flag;
 	 // var_names needs to be put into sorted order!
 	 // if var_names empty, no variables;
 	 // if wildcard_number is zero, no wildcards
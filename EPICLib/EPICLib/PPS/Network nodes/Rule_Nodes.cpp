@@ -17,9 +17,13 @@
 
 #include <string>
 #include <iostream>
+#include <vector>
+#include <algorithm>
 
 using std::string;
 using std::ostream;	using std::cout; using std::endl; using std::cerr; 
+using std::vector;
+using std::find;
 
 
 using namespace Parsimonious_Production_System;
@@ -33,7 +37,7 @@ namespace Parsimonious_Production_System {
 
 // define static member variables
 
-bool Rule_Node::debug_flag = false;
+thread_local bool Rule_Node::debug_flag = false;
 
 // create the appropriate rule node based on variables & predicates
 Combining_Node * Rule_Node::create(Production_System * production_system_ptr, 
@@ -65,13 +69,72 @@ Combining_Node * Rule_Node::create(Production_System * production_system_ptr,
 }
 
 
-void Rule_Node::instantiate_pattern(const Symbol_list_t& pattern, const Binding_set& bs, Symbol_list_t& result) const
+Action_pattern::Action_pattern(const Symbol_list_t& pattern_, Symbol_vector_t& var_names) :
+	pattern(pattern_), n_variables(0), clause(pattern_)
+{
+	for(Symbol_list_t::const_iterator it = pattern.begin(); it != pattern.end(); it++) {
+		if(!is_variable(*it)) {
+			var_indices.push_back(-1);
+			continue;
+			}
+		Symbol_vector_t::const_iterator var_it = find(var_names.begin(), var_names.end(), *it);
+		var_indices.push_back(int(var_it - var_names.begin()));
+		if(var_it == var_names.end())
+			var_names.push_back(*it);
+		n_variables++;
+		}
+}
+
+Command_action::Command_action(const Symbol_list_t& command, Symbol_vector_t& var_names) :
+	pattern(command, var_names), kind_is_known(!is_variable(command.front())), kind(Command_interface::INVALID_COMMAND),
+	motor_factory(0), execute_when_prepared(false), motor_arguments(Symbol_list_t(), var_names)
+{
+	if(!kind_is_known)
+		return;
+	kind = Command_interface::get_command_kind(command.front());
+	// (Send_to_motor modality command argument ...) - Motor_action::create requires at least one argument
+	if(kind != Command_interface::MOTOR_COMMAND || command.size() < 4)
+		return;
+	Symbol_list_t::const_iterator it = command.begin();
+	modality = *++it;
+	motor_command = *++it;
+	if(is_variable(modality) || is_variable(motor_command))
+		return;
+	motor_factory = Motor_action::get_factory(modality, motor_command, execute_when_prepared);
+	if(motor_factory)
+		motor_arguments = Action_pattern(Symbol_list_t(++it, command.end()), var_names);
+}
+
+void Rule_Node::prepare_actions()
+{
+	for(list_Symbol_list_t::const_iterator it = add_action_patterns.begin(); it != add_action_patterns.end(); it++)
+		add_actions.push_back(Action_pattern(*it, action_var_names));
+	for(list_Symbol_list_t::const_iterator it = delete_action_patterns.begin(); it != delete_action_patterns.end(); it++)
+		delete_actions.push_back(Action_pattern(*it, action_var_names));
+	for(list_Symbol_list_t::const_iterator it = command_actions.begin(); it != command_actions.end(); it++)
+		commands.push_back(Command_action(*it, action_var_names));
+	for(list_Symbol_list_t::const_iterator it = add_command_patterns.begin(); it != add_command_patterns.end(); it++)
+		add_command_pattern_actions.push_back(Action_pattern(*it, action_var_names));
+}
+
+void Rule_Node::get_action_values(const Binding_set& bs, Symbol_vector_t& values) const
+{
+	values.clear();
+	for(Symbol_vector_t::const_iterator it = action_var_names.begin(); it != action_var_names.end(); it++)
+		values.push_back(bs.get_value(*it));
+}
+
+// returns result, or the pattern itself if there is nothing to replace
+const Symbol_list_t& Rule_Node::instantiate_pattern(const Action_pattern& pattern, const Symbol_vector_t * values_ptr, Symbol_list_t& result) const
 {	
+	if(!values_ptr || !pattern.has_variables())
+		return pattern.get_pattern();
+
 	const Symbol no_value;	// contains default for no value
-	
-	for(Symbol_list_t::const_iterator it = pattern.begin(); it != pattern.end(); it++) {
-		if (is_variable(*it)) {
-			Symbol var_value(bs.get_value(*it));
+	vector<int>::const_iterator index_it = pattern.var_indices.begin();
+	for(Symbol_list_t::const_iterator it = pattern.pattern.begin(); it != pattern.pattern.end(); it++, index_it++) {
+		if (*index_it >= 0) {
+			const Symbol& var_value = (*values_ptr)[*index_it];
 			if (var_value == no_value) {
 				string msg = string("In rule ") + rule_name.str() + string(": variable ") + (*it).str() + string(" has no value");
 				throw PPS_exception(msg);
@@ -85,6 +148,29 @@ void Rule_Node::instantiate_pattern(const Symbol_list_t& pattern, const Binding_
 		else
 			result.push_back(*it);
 		}
+	return result;
+}
+
+void Rule_Node::execute_command(const Command_action& command_action, const Symbol_vector_t * values_ptr,
+	Command_interface& command_interface, bool output) const
+{
+	Symbol_list_t result;
+	if(command_action.motor_factory) {
+		Symbol_list_t motor_result;
+		command_interface.dispatch_motor(command_action.modality, command_action.motor_command, 
+			command_action.motor_factory, command_action.execute_when_prepared, 
+			instantiate_pattern(command_action.motor_arguments, values_ptr, motor_result));
+		if(output)
+			PPS_out << "  Command: " << instantiate_pattern(command_action.pattern, values_ptr, result) << endl;
+		return;
+		}
+	const Symbol_list_t& arguments = instantiate_pattern(command_action.pattern, values_ptr, result);
+	if(command_action.kind_is_known)
+		command_interface.dispatch(command_action.kind, arguments);
+	else
+		command_interface.dispatch(arguments);
+	if(output)
+		PPS_out << "  Command: " << arguments << endl;	// Changed for temporal.  Was "  Motor Command: "
 }
 
 
@@ -169,33 +255,30 @@ void Simple_Rule_Node::execute(Command_interface& command_interface) const
 	if(output)
 		PPS_out << "*** Fire: " << rule_name << endl;
 
-	for(list_Symbol_list_t::const_iterator it1 = add_action_patterns.begin(); it1 != add_action_patterns.end(); it1++) {
+	for(vector<Action_pattern>::const_iterator it1 = add_actions.begin(); it1 != add_actions.end(); it1++) {
 		if(output)
-			PPS_out << "  Add: " << *it1 << endl;
-		production_system_ptr->add_to_add_clause_list(Clause(*it1));
+			PPS_out << "  Add: " << it1->get_pattern() << endl;
+		production_system_ptr->add_to_add_clause_list(it1->get_clause());
 		}
 	
-	for(list_Symbol_list_t::const_iterator it2 = delete_action_patterns.begin(); it2 != delete_action_patterns.end(); it2++) {
+	for(vector<Action_pattern>::const_iterator it2 = delete_actions.begin(); it2 != delete_actions.end(); it2++) {
 		if(output)
-			PPS_out << "  Delete: " << *it2 << endl;
-		production_system_ptr->add_to_delete_clause_list(Clause(*it2));
+			PPS_out << "  Delete: " << it2->get_pattern() << endl;
+		production_system_ptr->add_to_delete_clause_list(it2->get_clause());
 		}
 	
-	for(list_Symbol_list_t::const_iterator it3 = command_actions.begin(); it3 != command_actions.end(); it3++) {
-		command_interface.dispatch(*it3);
-		if(output)
-			PPS_out << "  Command: " << (*it3) << endl;		// Changed for temporal.  Was "  Motor Command: "
-		}
+	for(vector<Command_action>::const_iterator it3 = commands.begin(); it3 != commands.end(); it3++)
+		execute_command(*it3, 0, command_interface, output);
 
     // only one at most add_command action and pattern should be present and used
     if(!add_command_actions.empty()) {
-        Symbol_list_t command = add_command_actions.front();
-        Symbol_list_t pattern = add_command_patterns.front();
+        const Symbol_list_t& command = add_command_actions.front();
+        const Action_pattern& pattern = add_command_pattern_actions.front();
         if(output)
-            PPS_out << ' ' << command.front() << ' ' << command.back() << ' ' << pattern;
-		bool to_add = command_interface.dispatch(command, pattern);
+            PPS_out << ' ' << command.front() << ' ' << command.back() << ' ' << pattern.get_pattern();
+		bool to_add = command_interface.dispatch(command, pattern.get_pattern());
         if(to_add)
-            production_system_ptr->add_to_add_clause_list(Clause(pattern));
+            production_system_ptr->add_to_add_clause_list(pattern.get_clause());
         if(output) {
             if(to_add)
                 PPS_out << ": Added" << endl;
@@ -302,47 +385,41 @@ void Bindings_Rule_Node::execute_with_bindings(const Binding_set_list_t& binding
 		PPS_out << "*** Fire: " << rule_name << endl;
 
 	// for each binding set, and for each pattern in add patterns, add the add clauses, ditto with delete patterns and commands
+	Symbol_vector_t values;
 	for(Binding_set_list_t::const_iterator bs_it = binding_set_list.begin(); bs_it != binding_set_list.end(); bs_it++) {
 		if(output)
 			PPS_out << "  Bindings: " << *bs_it << endl;
-		for(list_Symbol_list_t::const_iterator it1 = add_action_patterns.begin(); it1 != add_action_patterns.end(); it1++) {
+		get_action_values(*bs_it, values);
+		for(vector<Action_pattern>::const_iterator it1 = add_actions.begin(); it1 != add_actions.end(); it1++) {
 			Symbol_list_t result;
-			instantiate_pattern(*it1, *bs_it, result);
-			Clause clause(result);
+			Clause clause(instantiate_pattern(*it1, &values, result));
 			if(output)
 				PPS_out << "  Add: " << clause << endl;
 			production_system_ptr->add_to_add_clause_list(clause);
 			}
 			
-		for(list_Symbol_list_t::const_iterator it2 = delete_action_patterns.begin(); it2 != delete_action_patterns.end(); it2++) {
+		for(vector<Action_pattern>::const_iterator it2 = delete_actions.begin(); it2 != delete_actions.end(); it2++) {
 			Symbol_list_t result;
-			instantiate_pattern(*it2, *bs_it, result);
-			Clause clause(result);
+			Clause clause(instantiate_pattern(*it2, &values, result));
 			if(output)
 				PPS_out << "  Delete: " << clause << endl;
 			production_system_ptr->add_to_delete_clause_list(clause);
 			}
 
 
-		for(list_Symbol_list_t::const_iterator it3 = command_actions.begin(); it3 != command_actions.end(); it3++) {
-			Symbol_list_t result;
-			instantiate_pattern((*it3), *bs_it, result);
-			command_interface.dispatch(result);
-			if(output)
-				PPS_out << "  Command: " << (result) << endl;	// Changed for temporal.  Was "  Motor Command: "
-			}
+		for(vector<Command_action>::const_iterator it3 = commands.begin(); it3 != commands.end(); it3++)
+			execute_command(*it3, &values, command_interface, output);
         
         // only one at most add_command action and pattern should be present and used
         if(!add_command_actions.empty()) {
-            Symbol_list_t command = add_command_actions.front();
-            Symbol_list_t pattern = add_command_patterns.front();
+            const Symbol_list_t& command = add_command_actions.front();
             Symbol_list_t result;
-            instantiate_pattern(pattern, *bs_it, result);
+            const Symbol_list_t& pattern = instantiate_pattern(add_command_pattern_actions.front(), &values, result);
             if(output)
-                PPS_out << ' ' << command.front() << ' ' << command.back() << ' ' << result;
-            bool to_add = command_interface.dispatch(command, result);
+                PPS_out << ' ' << command.front() << ' ' << command.back() << ' ' << pattern;
+            bool to_add = command_interface.dispatch(command, pattern);
             if(to_add)
-                production_system_ptr->add_to_add_clause_list(Clause(result));
+                production_system_ptr->add_to_add_clause_list(Clause(pattern));
             if(output) {
                 if(to_add)
                     PPS_out << ": Added" << endl;
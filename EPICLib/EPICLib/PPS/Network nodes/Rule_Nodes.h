@@ -4,6 +4,7 @@
 #include <iostream>
 #include <string>
 #include <list>
+#include <vector>
 
 #include "Assert_throw.h"
 #include "Output_tee.h"
@@ -17,6 +18,8 @@
 #include "Predicate.h"
 //#include "Command_Action.h"
 #include "Motor_action.h"
+#include "Command_interface.h"
+#include "Clause.h"
 
 namespace Parsimonious_Production_System {
 using ::operator<<;	// bring global declarations into scope
@@ -25,6 +28,49 @@ using std::operator<<;	// bring global declarations into scope
 //forward declaration
 class Production_System;
 
+typedef std::vector<Symbol> Symbol_vector_t;
+
+// An action pattern prepared when the rule is built. Each term that is a variable is given
+// the index of the variable in the rule's list of action variables, so that on each firing the pattern
+// is instantiated from the values of those variables without looking up every term.
+class Action_pattern {
+public:
+	// variables not already in var_names are added to it
+	Action_pattern(const Symbol_list_t& pattern_, Symbol_vector_t& var_names);
+
+	const Symbol_list_t& get_pattern() const
+		{return pattern;}
+	bool has_variables() const
+		{return n_variables > 0;}
+	// the pattern as a Clause, made once
+	const Clause& get_clause() const
+		{return clause;}
+	
+private:
+	Symbol_list_t pattern;
+	std::vector<int> var_indices;	// for each term, the index of its variable, or -1 if it is not one
+	int n_variables;
+	Clause clause;
+	
+	friend class Rule_Node;
+};
+
+// A command action prepared when the rule is built. The kind of command is found from its 
+// first term, and if it is a motor command whose modality and command are not variables, 
+// the Motor_action create method is found as well.
+struct Command_action {
+	Command_action(const Symbol_list_t& command, Symbol_vector_t& var_names);
+
+	Action_pattern pattern;
+	bool kind_is_known;		// false if the first term is a variable
+	Command_interface::Command_kind_e kind;
+	Symbol modality;
+	Symbol motor_command;
+	Motor_action::Factory_t motor_factory;	// zero unless the motor command can be created directly
+	bool execute_when_prepared;
+	Action_pattern motor_arguments;	// the terms after the modality and command
+};
+
 
 // A mixin class for shared functions and variables
 class Rule_Node {
@@ -34,13 +80,14 @@ public:
 			const list_Symbol_list_t& add_action_list, const list_Symbol_list_t& delete_action_list, const list_Symbol_list_t& command_action_list,
             const list_Symbol_list_t& add_command_action_list, const list_Symbol_list_t& add_command_pattern_list) :
 		production_system_ptr(in_production_system_ptr), input(in_input), rule_name(in_rule_name),
-		faulted_flag(false), break_flag(false), add_action_patterns(add_action_list), delete_action_patterns(delete_action_list),
+		faulted_flag(false), break_flag(false), firings(0), execution_time(0.),
+		add_action_patterns(add_action_list), delete_action_patterns(delete_action_list),
 		command_actions(command_action_list), add_command_actions(add_command_action_list), add_command_patterns(add_command_pattern_list)
-		{}
+		{prepare_actions();}
 	
 	virtual ~Rule_Node()
 		{}
-	static bool debug_flag;
+	static thread_local bool debug_flag;
 
 	static Combining_Node * create(Production_System * production_system_ptr, 
 		const Symbol& rule_name, Combining_Node * source, 
@@ -56,6 +103,11 @@ public:
 	void set_fault_state(bool faulted_flag_) {faulted_flag = faulted_flag_;}
 	bool get_break_state() const {return break_flag;}
 	void set_break_state(bool break_flag_) {break_flag = break_flag_;}
+	// accessors for profile data - the number of firings and seconds spent executing
+	long get_firings() const {return firings;}
+	double get_execution_time() const {return execution_time;}
+	void add_firing(double time) {firings++; execution_time += time;}
+	void clear_firings() {firings = 0; execution_time = 0.;}
 	
 	// execute the rule actions
 	virtual void execute(Command_interface&) const = 0;	// pure virtuals
@@ -67,16 +119,31 @@ protected:
 	const Symbol rule_name;
 	bool faulted_flag;	// flag that this rule has been faulted
 	bool break_flag;		// flag to break when this rule is executed
+	long firings;			// profile data
+	double execution_time;
 	const list_Symbol_list_t add_action_patterns;
 	const list_Symbol_list_t delete_action_patterns;
 	const list_Symbol_list_t command_actions;
 	const list_Symbol_list_t add_command_actions;
 	const list_Symbol_list_t add_command_patterns;
-
+	// the actions prepared from the above
+	Symbol_vector_t action_var_names;
+	std::vector<Action_pattern> add_actions;
+	std::vector<Action_pattern> delete_actions;
+	std::vector<Command_action> commands;
+	std::vector<Action_pattern> add_command_pattern_actions;
+
+	// set values to the value of each action variable in the binding set, in the order of action_var_names
+	void get_action_values(const Binding_set& bs, Symbol_vector_t& values) const;
 //	static void instantiate_pattern(const Symbol_list_t& pattern, const Binding_set& bs, Symbol_list_t& result);
-	void instantiate_pattern(const Symbol_list_t& pattern, const Binding_set& bs, Symbol_list_t& result) const;
+	// put the pattern into result, with each variable replaced by its value, and return it;
+	// if values_ptr is zero, or there are no variables, the pattern itself is returned
+	const Symbol_list_t& instantiate_pattern(const Action_pattern& pattern, const Symbol_vector_t * values_ptr, Symbol_list_t& result) const;
+	void execute_command(const Command_action& command_action, const Symbol_vector_t * values_ptr,
+		Command_interface& command_interface, bool output) const;
 	
 private:
+	void prepare_actions();
 	Rule_Node();
 };
 
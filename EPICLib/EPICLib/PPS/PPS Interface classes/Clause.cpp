@@ -65,6 +65,15 @@ bool Clause::operator< (const Clause& rhs) const
 	return false;	// were either identical, or rhs was shorter
 }
 
+// combine the hashes of the terms, which are cheap because Symbols are compared by identity
+size_t Clause::hash() const
+{
+	size_t result = clause.size();
+	for(Symbol_list_t::const_iterator it = clause.begin(); it != clause.end(); ++it)
+		result = result * 31 + it->hash();
+	return result;
+}
+
 void Clause::display(ostream& os) const
 {
 	os << clause;
@@ -4,6 +4,7 @@
 #include "Symbol.h"
 #include "Symbol_utilities.h"
 #include <list>
+#include <cstddef>
 #include <string>
 #include <iostream>
 
@@ -86,8 +87,13 @@ public:
 			current_term = clause.begin();
 			return *this;
 		}
+	// Clauses are equal if their terms are equal
+	bool operator== (const Clause& rhs) const
+		{return clause == rhs.clause;}
 	// order Clauses by comparing corresponding terms using operator<
 	bool operator< (const Clause& rhs) const;
+	// a hash value consistent with operator==, for use in unordered containers
+	std::size_t hash() const;
 	// output the clause and the current term
 	void display(std::ostream& os) const;
 	// output just the clause
@@ -108,6 +114,12 @@ private:
 
 typedef std::list<Clause> Clause_list_t;
 
+// function object class for hashing Clauses
+struct Clause_hash {
+	std::size_t operator() (const Clause& c) const
+		{return c.hash();}
+};
+
 std::ostream& operator<< (std::ostream& os, const Clause& in_clause);
 
 
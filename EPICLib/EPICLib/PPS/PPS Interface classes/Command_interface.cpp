@@ -29,9 +29,25 @@ public:
 // dispatching consists of calling an action virtual-constructor to create a Motor_action object
 // with the appropriate parameters and then sending it to the appropriate processor for its type
 
+Command_interface::Command_kind_e Command_interface::get_command_kind(const Symbol& command_name)
+{
+	if(command_name == "Log")
+		return LOG_COMMAND;
+	else if(command_name == "Send_to_temporal")
+		return TEMPORAL_COMMAND;
+	else if(command_name == "Send_to_motor")
+		return MOTOR_COMMAND;
+	return INVALID_COMMAND;
+}
+
 void Command_interface::dispatch(const Symbol_list_t& arguments)
+{
+	dispatch(get_command_kind(arguments.front()), arguments);
+}
+
+void Command_interface::dispatch(Command_kind_e kind, const Symbol_list_t& arguments)
 {	
-	if(arguments.front() == "Log") {
+	if(kind == LOG_COMMAND) {
 		PPS_out << human_ptr->processor_info();
 		for(Symbol_list_t::const_iterator it = arguments.begin(); it != arguments.end(); it++) {
 			PPS_out << (*it) << ' ';
@@ -43,7 +59,7 @@ void Command_interface::dispatch(const Symbol_list_t& arguments)
 
 	// Start and end the temporal counter directly, rather than adding 'start' and 'end' events to the queue.
 	// added by ajh & teh 2 - 3/17/08
-	else if(arguments.front() == "Send_to_temporal")
+	else if(kind == TEMPORAL_COMMAND)
 	{	
 		Symbol_list_t args = arguments;	// so we can modify the argument list
 		args.pop_front();
@@ -61,7 +77,7 @@ void Command_interface::dispatch(const Symbol_list_t& arguments)
 	}
 
 	// Previously DK just assumed at this point it would be Send_to_motor.  ajh & teh made it explicit.
-	else if(arguments.front() == "Send_to_motor")		// "else if" added by ajh & teh 2 - 3/17/08
+	else if(kind == MOTOR_COMMAND)		// "else if" added by ajh & teh 2 - 3/17/08
 	{
 		// Remove the "Send_to_motor" - ajh & teh
 		Symbol_list_t args = arguments;	// so we can modify the argument list
@@ -84,6 +100,22 @@ void Command_interface::dispatch(const Symbol_list_t& arguments)
 	}
 }
 
+// the same as dispatching (Send_to_motor modality command motor_arguments ...), 
+// with the modality and command already checked
+void Command_interface::dispatch_motor(const Symbol& modality, const Symbol& command, 
+	Motor_action::Factory_t factory, bool execute_when_prepared, const Symbol_list_t& motor_arguments)
+{
+	shared_ptr<Motor_action> action_ptr = factory(human_ptr, motor_arguments, execute_when_prepared);
+	if(!action_ptr) {
+		Symbol_list_t args = motor_arguments;
+		args.push_front(command);
+		args.push_front(modality);
+		throw Command_exception(human_ptr, 
+			string("Invalid rule action specification: (") + concatenate_to_string(args) + ")");
+		}
+	action_ptr->dispatch(human_ptr->get_Cognitive_processor_ptr()->get_step_end_time());
+}
+
 // all this function does is to decide whether the pattern should be added, returning true if so
 bool Command_interface::dispatch(const Symbol_list_t& arguments, const Symbol_list_t& pattern)
 {
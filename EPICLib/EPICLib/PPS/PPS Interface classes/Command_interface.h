@@ -3,6 +3,7 @@
 
 #include "Symbol.h"
 #include "Symbol_utilities.h"
+#include "Motor_action.h"
 
 // this class acts to couple between the PPS Rule-node executor and the rest of the EPIC
 // system by providing a layer of indirection between the two.
@@ -15,7 +16,17 @@ public:
 		human_ptr(human_ptr_)
 		{}
 		
+	// the kinds of command, named by the first term of the arguments
+	enum Command_kind_e {INVALID_COMMAND, LOG_COMMAND, TEMPORAL_COMMAND, MOTOR_COMMAND};
+	static Command_kind_e get_command_kind(const Symbol& command_name);
+
 	void dispatch(const Symbol_list_t& parameters);
+	// dispatch a command whose kind has already been found from its first term
+	void dispatch(Command_kind_e kind, const Symbol_list_t& arguments);
+	// dispatch a motor command using the Motor_action create method for its modality and command;
+	// the motor arguments are those that follow the modality and command
+	void dispatch_motor(const Symbol& modality, const Symbol& command, 
+		Motor_action::Factory_t factory, bool execute_when_prepared, const Symbol_list_t& motor_arguments);
     // return true if the pattern should be added, false if not
 	bool dispatch(const Symbol_list_t& parameters, const Symbol_list_t& pattern);
 
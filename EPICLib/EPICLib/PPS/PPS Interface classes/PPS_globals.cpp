@@ -1,4 +1,4 @@
 // global output objects
 #include "PPS_globals.h"
 
-Output_tee PPS_out;
+thread_local Output_tee PPS_out;
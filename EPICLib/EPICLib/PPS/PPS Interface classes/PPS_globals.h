@@ -3,7 +3,7 @@
 
 #include "Output_tee.h"
 
-// global output objects
-extern Output_tee PPS_out;
+// global output objects - one per thread, like Normal_out and Trace_out
+extern thread_local Output_tee PPS_out;
 
 #endif
@@ -21,6 +21,8 @@
 #include <ctime>
 #include <cstdlib>
 #include <algorithm>
+#include <vector>
+#include <chrono>
 
 using std::cout; using std::endl; using std::cerr;
 using std::ifstream;
@@ -30,6 +32,9 @@ using std::set;
 using std::map;
 using std::clock_t; using std::clock;
 using std::exit;
+using std::vector;
+using std::sort;
+using std::chrono::steady_clock; using std::chrono::duration;
 
 namespace Parsimonious_Production_System {
 
@@ -177,8 +182,13 @@ void Production_System::reset()
 	add_clause_list.clear();
 	delete_clause_list.clear();
 	updates_done = 0;	// no updates waiting
+	rule_updates_applied = 0;
+	rule_updates_elided = 0;
 	// empty the memory contents container used for displaying the current memory state
 	memory_contents.clear();
+	// each run has its own profile
+	if(profiling_enabled)
+		clear_profile();
 }
 
 
@@ -323,7 +333,7 @@ void Production_System::update_add_clause(const Clause& in_clause)
 		}	
 */
 	if(maintain_memory_contents)
-		memory_contents[in_clause.get_tag()].insert(in_clause);
+		memory_contents.insert(in_clause);
 		
 	updates_done++;
 }
@@ -347,26 +357,31 @@ void Production_System::update_delete_clause(const Clause& in_clause)
 	updates_done++;
 */
 	if(maintain_memory_contents)
-		memory_contents[in_clause.get_tag()].erase(in_clause);
+		memory_contents.erase(in_clause);
 }
 
+// The clauses are kept unordered, so updating them is cheap; the display
+// sorts the clauses under each display tag only when it is requested.
 void Production_System::display_memory_contents() const
 {
 	if(!PPS_out)
 		return;
+	map<Symbol, set<Clause> > displayed_contents;
+	for (Symbol_list_t::const_iterator tag_it = display_tags.begin(); tag_it != display_tags.end(); tag_it++)
+		displayed_contents[*tag_it];
+	for (Clause_set_t::const_iterator it = memory_contents.begin(); it != memory_contents.end(); ++it) {
+		map<Symbol, set<Clause> >::iterator tag_contents_it = displayed_contents.find(it->get_tag());
+		if(tag_contents_it != displayed_contents.end())
+			tag_contents_it->second.insert(*it);
+		}
 	for (Symbol_list_t::const_iterator tag_it = display_tags.begin(); tag_it != display_tags.end(); tag_it++) {
+		const set<Clause>& tag_set = displayed_contents[*tag_it];
 		// print tag on a line if there will be contents for it
-		if(memory_contents[*tag_it].begin() != memory_contents[*tag_it].end())
+		if(!tag_set.empty())
 			PPS_out << *tag_it << endl;
-//		const set<Clause> & tag_set = memory_contents[*tag_it];
-//		for (set<Clause>::const_iterator clause_it = tag_set.begin(); clause_it != tag_set.end(); clause_it++) {
-		for (set<Clause>::const_iterator clause_it = memory_contents[*tag_it].begin(); 
-			 clause_it != memory_contents[*tag_it].end(); clause_it++) {
+		for (set<Clause>::const_iterator clause_it = tag_set.begin(); clause_it != tag_set.end(); clause_it++) {
 			PPS_out << "  " << *clause_it << endl;
 			}
-        if (memory_contents.empty()) {
-            PPS_out << endl;
-        }
 	}
 }
 
@@ -376,6 +391,8 @@ bool Production_System::run_cycle(long time, Command_interface& command_interfac
 {
 	Assert(root_node_ptr);
 	break_on_this_cycle = false;
+	// the flag is per-thread; make sure it is this production system's setting
+	Combining_Node::profiling_flag = profiling_enabled;
 	updates_done += delete_clause_list.size();
 	updates_done += add_clause_list.size();
 
@@ -386,16 +403,9 @@ bool Production_System::run_cycle(long time, Command_interface& command_interfac
 //	Discrimination_Node::debug_flag = true;
 	if (updates_done && output_run_messages && output_run_details && PPS_out)
 		PPS_out << updates_done << " update clauses: ";
-	// update using each delete clause, then empty the list
-	for (Clause_list_t::iterator del_it = delete_clause_list.begin(); del_it != delete_clause_list.end(); del_it++) {
-		update_delete_clause(*del_it);
-		}
-	delete_clause_list.clear();
-	// update using each add clause, then empty the list
-	for (Clause_list_t::iterator add_it = add_clause_list.begin(); add_it != add_clause_list.end(); add_it++) {
-		update_add_clause(*add_it);
-		}
-	add_clause_list.clear();
+	// update using each delete clause, then each add clause, emptying the lists
+	apply_update_list(delete_clause_list, false);
+	apply_update_list(add_clause_list, true);
 
 	// show updated contents of memory only if updates done or rules fired
 	if(output_run_memory_contents && maintain_memory_contents && (updates_done || fired_rules.size())) {
@@ -432,7 +442,13 @@ bool Production_System::run_cycle(long time, Command_interface& command_interfac
 		}
 	for (Rule_Node_ptr_list_t::iterator fired_it = fired_rules.begin(); fired_it != fired_rules.end(); fired_it++) {
 		Rule_Node * fired_rule_ptr = *fired_it;
-		fired_rule_ptr->execute(command_interface);
+		if(profiling_enabled) {
+			steady_clock::time_point start = steady_clock::now();
+			fired_rule_ptr->execute(command_interface);
+			fired_rule_ptr->add_firing(duration<double>(steady_clock::now() - start).count());
+			}
+		else
+			fired_rule_ptr->execute(command_interface);
 		if(break_enabled && fired_rule_ptr->get_break_state()) {
 			PPS_out << "Break on this cycle from rule: " << fired_rule_ptr->get_name() << endl;
 			break_on_this_cycle = true;
@@ -447,6 +463,106 @@ bool Production_System::run_cycle(long time, Command_interface& command_interfac
 	return true;
 }
 
+/*
+The network holds a set of clauses, so adding a clause a second time, or deleting it a second time,
+changes nothing, and only the first occurrence of a clause in each list needs to be propagated.
+A clause that is in both lists is still deleted and then added: if it is present, the add moves its
+binding sets and the rules they enable after the others, which can change which rules fire
+and which instantiation a Use_only_one rule gets.
+*/
+void Production_System::apply_update_list(Clause_list_t& clause_list, bool add)
+{
+	// most lists have only one or two clauses; no need to look for repeats in those
+	set<Clause> clauses_applied;
+	bool check_repeats = clause_list.size() > 1;
+	for (Clause_list_t::iterator it = clause_list.begin(); it != clause_list.end(); it++) {
+		if(check_repeats && !clauses_applied.insert(*it).second) {
+			if(output_run_details && PPS_out)
+				PPS_out << "Repeated " << ((add) ? "add: " : "delete: ") << *it << endl;
+			rule_updates_elided++;
+			continue;
+			}
+		if(add)
+			update_add_clause(*it);
+		else
+			update_delete_clause(*it);
+		rule_updates_applied++;
+		}
+	clause_list.clear();
+}
+
+void Production_System::set_profiling_enabled(bool flag)
+{
+	profiling_enabled = flag;
+	Combining_Node::profiling_flag = flag;
+}
+
+void Production_System::clear_profile()
+{
+	Combining_Node_ptr_set_t combining_nodes;
+	for(Combining_Node_ptr_list_t::const_iterator it = pattern_nodes.begin(); it != pattern_nodes.end(); it++) {
+		(*it)->accumulate_nodes(combining_nodes);
+		}
+	for(Combining_Node_ptr_set_t::iterator it = combining_nodes.begin(); it != combining_nodes.end(); it++) {
+		(*it)->clear_profile();
+		}
+	for(Rule_Node_ptr_list_t::const_iterator it = rule_nodes.begin(); it != rule_nodes.end(); it++) {
+		(*it)->clear_firings();
+		}
+}
+
+// the cost of a rule is the time spent updating its rule node, including predicates, plus executing it
+static double rule_cost(const Rule_Node * rule_ptr)
+{
+	const Combining_Node * node_ptr = dynamic_cast<const Combining_Node *>(rule_ptr);
+	return node_ptr->get_profile().total_time + rule_ptr->get_execution_time();
+}
+
+static bool higher_rule_cost(const Rule_Node * p1, const Rule_Node * p2)
+{
+	return rule_cost(p1) > rule_cost(p2);
+}
+
+static bool higher_self_time(const Combining_Node * p1, const Combining_Node * p2)
+{
+	return p1->get_profile().self_time > p2->get_profile().self_time;
+}
+
+// output the rules, and then the network nodes that received updates, in order of decreasing cost
+void Production_System::display_profile() const
+{
+	if(!PPS_out)
+		return;
+	PPS_out << "*** Production system profile after " << cycle_counter << " cycles ***" << endl;
+	PPS_out << rule_updates_applied << " clauses applied from the update lists, "
+		<< rule_updates_elided << " repeats dropped" << endl;
+
+	vector<const Rule_Node *> rules(rule_nodes.begin(), rule_nodes.end());
+	sort(rules.begin(), rules.end(), higher_rule_cost);
+	PPS_out << "Rules in order of cost:" << endl;
+	for(vector<const Rule_Node *>::const_iterator it = rules.begin(); it != rules.end(); ++it) {
+		const Combining_Node * node_ptr = dynamic_cast<const Combining_Node *>(*it);
+		PPS_out << (*it)->get_name() << ": " << (*it)->get_firings() << " firings, "
+			<< (*it)->get_execution_time() << " sec executing, "
+			<< node_ptr->get_profile().total_time << " sec updating" << endl;
+		}
+
+	Combining_Node_ptr_set_t combining_nodes;
+	for(Combining_Node_ptr_list_t::const_iterator it = pattern_nodes.begin(); it != pattern_nodes.end(); it++) {
+		(*it)->accumulate_nodes(combining_nodes);
+		}
+	vector<const Combining_Node *> nodes;
+	for(Combining_Node_ptr_set_t::const_iterator it = combining_nodes.begin(); it != combining_nodes.end(); ++it) {
+		const Combining_Node_profile& profile = (*it)->get_profile();
+		if(profile.positive_updates || profile.negative_updates)
+			nodes.push_back(*it);
+		}
+	sort(nodes.begin(), nodes.end(), higher_self_time);
+	PPS_out << "Network nodes in order of self time:" << endl;
+	for(vector<const Combining_Node *>::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+		(*it)->display_profile();
+		}
+}
 
 Geometry_Utilities::Point Production_System::get_named_location(const Symbol& name, bool& found) const
 {
@@ -13,6 +13,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_set>
 
 class Command_interface;
 
@@ -30,13 +31,18 @@ public:
 		output_compiler_messages(false), output_compiler_details(false),
 		output_run_messages(false), output_run_details(false),
 		output_run_memory_contents(false), break_enabled(false), fault_enabled(false),
-		cycle_counter(0), break_on_this_cycle(false), updates_done(0), root_node_ptr(0)
+		profiling_enabled(false),
+		cycle_counter(0), break_on_this_cycle(false), updates_done(0),
+		rule_updates_applied(0), rule_updates_elided(0), root_node_ptr(0)
 		{}
 	
 	~Production_System();
 	
 	long get_cycle_counter() const
 		{return cycle_counter;}
+	// count cycles that were not run because no rule could fire and memory could not change
+	void count_idle_cycles(long n)
+		{cycle_counter += n;}
 	
 	// get/set output flags
 	bool get_output_compiler_messages() const
@@ -64,6 +70,13 @@ public:
 	void set_output_run_memory_contents(bool flag)
 		{output_run_memory_contents = flag;}
 
+	// if true, each network node counts and times its updates, and each rule its firings
+	bool get_profiling_enabled() const
+		{return profiling_enabled;}
+	void set_profiling_enabled(bool flag);
+	void clear_profile();				// zero the profile data in all nodes
+	void display_profile() const;		// output the profile data sorted by cost
+
 	
 	
 	
@@ -124,6 +137,13 @@ public:
 	void remove_from_fired_rules(Rule_Node * p)
 		{fired_rules.remove(p);}
 
+	// number of clauses from the add and delete clause lists applied to the network, and
+	// the number dropped because they repeated an earlier clause in the same list, since reset
+	long get_rule_updates_applied() const
+		{return rule_updates_applied;}
+	long get_rule_updates_elided() const
+		{return rule_updates_elided;}
+
 	// call this function to see if inputs or updates present that might cause a firing
 	bool memory_updated() const
 		{return (updates_done || !add_clause_list.empty() || !delete_clause_list.empty());}
@@ -160,10 +180,13 @@ private:
 	bool output_run_memory_contents;
 	bool break_enabled;
 	bool fault_enabled;
+	bool profiling_enabled;
 
 	long cycle_counter;
 	bool break_on_this_cycle;					// true if a break-rule is executed
 	std::size_t updates_done;					// number of changes to data
+	long rule_updates_applied;					// clauses from the update lists applied
+	long rule_updates_elided;					// repeated clauses from the update lists dropped
 	Root_Node * root_node_ptr;					// root node for the discrimination net
 	std::list<Combining_Node *> pattern_nodes;	// list of pattern nodes
 	std::list<Rule_Node *> rule_nodes;			// list of rule nodes
@@ -177,7 +200,8 @@ private:
 	
 	Symbol_list_t display_tags;					// list of tags to be displayed
 	bool maintain_memory_contents;				// true if memory_contents maintained
-	mutable std::map<Symbol, std::set<Clause> > memory_contents;	// clauses grouped by tags
+	typedef std::unordered_set<Clause, Clause_hash> Clause_set_t;
+	Clause_set_t memory_contents;				// clauses currently in memory, in no particular order
 	
 	Symbol_list_t rule_names;					// list of all rule names
 	Symbol_list_t break_rule_names;				// list of rule names set with break set on
@@ -185,6 +209,8 @@ private:
 	
 	// return a pointer to the rule node with the supplied name
 	Rule_Node * get_rule_node(const Symbol& name, bool throw_not_there = true) const;
+	// apply each different clause in the list as an add or delete, then empty the list
+	void apply_update_list(Clause_list_t& clause_list, bool add);
 };
 
 
@@ -98,6 +98,33 @@ Symbol Binding_set::get_value(Symbol var_name) const
 	return Symbol();
 }
 
+// return the variable names, in order
+Symbol_list_t Binding_set::get_var_names() const
+{
+	Symbol_list_t result;
+	Binding_pair_list_t::const_iterator it;
+	for(it = binding_pair_list.begin(); it != binding_pair_list.end(); it++)
+		result.push_back(it->get_var_name());
+	return result;
+}
+
+// a linear scan for each variable, like get_value, but a missing variable
+// is distinguished from one whose value is the default Symbol
+bool Binding_set::get_values_hash(const Symbol_list_t& var_names, std::size_t& hash) const
+{
+	hash = 0;
+	for(Symbol_list_t::const_iterator name_it = var_names.begin(); name_it != var_names.end(); name_it++) {
+		Binding_pair_list_t::const_iterator it;
+		for(it = binding_pair_list.begin(); it != binding_pair_list.end(); it++)
+			if (*name_it == it->get_var_name())
+				break;
+		if(it == binding_pair_list.end())
+			return false;
+		hash = hash * 31 + it->get_var_value().hash();
+		}
+	return true;
+}
+
 // return a binding set that has wildcards removed
 Binding_set Binding_set::remove_wildcards() const
 {
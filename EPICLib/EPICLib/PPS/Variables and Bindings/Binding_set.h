@@ -5,6 +5,7 @@
 
 #include <iosfwd>
 #include <list>
+#include <cstddef>
 
 
 namespace Parsimonious_Production_System {
@@ -48,6 +49,11 @@ public:
 	bool is_legal() const;
 	// return the value for the variable name; return Symbol() if not found
 	Symbol get_value(Symbol var_name) const;
+	// return the variable names, in order
+	Symbol_list_t get_var_names() const;
+	// compute a hash of the values of the named variables;
+	// return false if any of the variables is not present
+	bool get_values_hash(const Symbol_list_t& var_names, std::size_t& hash) const;
 	
 private:
 	Binding_pair_list_t binding_pair_list;
@@ -6,7 +6,10 @@
 #include <iostream>
 	using std::ostream; using std::cerr; using std::endl;
 #include <algorithm>
+#include <iterator>
 using std::size_t;
+using std::back_inserter;
+using std::set_intersection;
 
 namespace Parsimonious_Production_System {
 using ::operator<<;	// bring global declarations into scope
@@ -66,10 +69,10 @@ bool Binding_set_list::is_legal() const
 bool Binding_set_list::add_binding_set(const Binding_set& bs)
 {
 	if (binding_set_list.size() > 0 && 
-		(find(binding_set_list.begin(), binding_set_list.end(), bs) != binding_set_list.end()) )
+		(find_binding_set(bs) != binding_set_list.end()) )
 		return false;	// already present, no change
 	
-	binding_set_list.push_back(bs);
+	append(bs);
 	return true;	// binding_set_list changed
 }
 
@@ -82,11 +85,11 @@ bool Binding_set_list::remove_binding_set(const Binding_set& bs)
 	if (binding_set_list.size() == 0)
 		return false;
 	// search nonempty list for binding set
-	Binding_set_list_t::iterator pos = find(binding_set_list.begin(), binding_set_list.end(), bs);
+	Binding_set_list_t::const_iterator pos = find_binding_set(bs);
 	if (pos == binding_set_list.end())
 		return false;	// not present, no change
 	
-	binding_set_list.erase(pos);
+	erase(pos);
 	return true;	// changed
 }
 
@@ -115,6 +118,118 @@ bool Binding_set_list::remove_binding_sets(const Binding_set_list& bsl)
 
 
 
+Binding_set_list& Binding_set_list::operator= (const Binding_set_list& rhs)
+{
+	if(this != &rhs) {
+		binding_set_list = rhs.binding_set_list;
+		value_indexes.clear();
+		}
+	return *this;
+}
+
+void Binding_set_list::clear()
+{
+	binding_set_list.clear();
+	value_indexes.clear();
+}
+
+// a short list is simply searched; otherwise only the binding sets with the same 
+// values for all of the variables need to be compared
+Binding_set_list_t::const_iterator Binding_set_list::find_binding_set(const Binding_set& bs) const
+{
+	if(binding_set_list.size() < min_indexed_size)
+		return find(binding_set_list.begin(), binding_set_list.end(), bs);
+	Binding_set_it_vector_t candidates;
+	get_candidates(bs, bs.get_var_names(), candidates);
+	for(Binding_set_it_vector_t::const_iterator it = candidates.begin(); it != candidates.end(); it++)
+		if(**it == bs)
+			return *it;
+	return binding_set_list.end();
+}
+
+void Binding_set_list::append(const Binding_set& bs)
+{
+	binding_set_list.push_back(bs);
+	Binding_set_list_t::const_iterator bs_it = --binding_set_list.end();
+	for(Value_index_list_t::iterator index_it = value_indexes.begin(); index_it != value_indexes.end(); index_it++) {
+		size_t key;
+		if(bs.get_values_hash(index_it->var_names, key))
+			index_it->buckets[key].push_back(bs_it);
+		else
+			index_it->n_unkeyed++;
+		}
+}
+
+void Binding_set_list::erase(Binding_set_list_t::const_iterator bs_it)
+{
+	for(Value_index_list_t::iterator index_it = value_indexes.begin(); index_it != value_indexes.end(); index_it++) {
+		size_t key;
+		if(bs_it->get_values_hash(index_it->var_names, key)) {
+			Binding_set_it_vector_t& bucket = index_it->buckets[key];
+			bucket.erase(std::find(bucket.begin(), bucket.end(), bs_it));
+			if(bucket.empty())
+				index_it->buckets.erase(key);
+			}
+		else
+			index_it->n_unkeyed--;
+		}
+	binding_set_list.erase(bs_it);
+}
+
+Binding_set_list::Value_index& Binding_set_list::get_value_index(const Symbol_list_t& var_names) const
+{
+	for(Value_index_list_t::iterator index_it = value_indexes.begin(); index_it != value_indexes.end(); index_it++)
+		if(index_it->var_names == var_names)
+			return *index_it;
+	
+	value_indexes.push_back(Value_index());
+	Value_index& index = value_indexes.back();
+	index.var_names = var_names;
+	index.n_unkeyed = 0;
+	for(Binding_set_list_t::const_iterator bs_it = binding_set_list.begin(); bs_it != binding_set_list.end(); bs_it++) {
+		size_t key;
+		if(bs_it->get_values_hash(var_names, key))
+			index.buckets[key].push_back(bs_it);
+		else
+			index.n_unkeyed++;
+		}
+	return index;
+}
+
+// Different values can hash to the same key, so the candidates still have to be compared,
+// but a binding set with different values for the variables is never a candidate.
+void Binding_set_list::get_candidates(const Binding_set& probe, const Symbol_list_t& var_names, 
+	Binding_set_it_vector_t& candidates) const
+{
+	candidates.clear();
+	size_t key;
+	if(!var_names.empty() && binding_set_list.size() >= min_indexed_size && probe.get_values_hash(var_names, key)) {
+		const Value_index& index = get_value_index(var_names);
+		if(index.n_unkeyed == 0) {
+			std::unordered_map<size_t, Binding_set_it_vector_t>::const_iterator bucket_it = index.buckets.find(key);
+			if(bucket_it != index.buckets.end())
+				candidates = bucket_it->second;
+			return;
+			}
+		}
+	for(Binding_set_list_t::const_iterator bs_it = binding_set_list.begin(); bs_it != binding_set_list.end(); bs_it++)
+		candidates.push_back(bs_it);
+}
+
+// the binding sets in a list all have the same variables, so only the first in each list
+// needs to be examined; the variable names are in order in each binding set
+Symbol_list_t Binding_set_list::get_shared_var_names(const Binding_set_list& first, const Binding_set_list& second)
+{
+	Symbol_list_t result;
+	if(first.binding_set_list.empty() || second.binding_set_list.empty())
+		return result;
+	Symbol_list_t first_names = first.binding_set_list.front().get_var_names();
+	Symbol_list_t second_names = second.binding_set_list.front().get_var_names();
+	set_intersection(first_names.begin(), first_names.end(), second_names.begin(), second_names.end(),
+		back_inserter(result));
+	return result;
+}
+
 /*
 // figure out explicit instantiation syntax for these
 
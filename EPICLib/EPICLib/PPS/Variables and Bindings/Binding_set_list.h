@@ -6,6 +6,9 @@
 
 #include <iosfwd>
 #include <list>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
 
 
 namespace Parsimonious_Production_System {
@@ -20,9 +23,23 @@ class Binding_set_list;
 // output each set in the list in the object on a line by itself
 std::ostream& operator<< (std::ostream& os, const Binding_set_list& bsl);
 
+/*
+A Binding_set_list can keep indexes of its binding sets on the values of some of the
+variables. The combination templates below use them to find the binding sets that could
+match a binding set from another list, namely those with the same values for the variables
+that the two lists share, instead of trying every pair. An index is built the first time it
+is needed for a long enough list, and is then kept up to date as binding sets are added and
+removed, so the binding sets in a node's input can be probed cheaply on each update.
+Copying a list does not copy its indexes.
+*/
+
 class Binding_set_list {
 public:
     Binding_set_list() {}   // default ctor to allow declaration of const empty object - dk 07/18/2012
+	Binding_set_list(const Binding_set_list& other) :
+		binding_set_list(other.binding_set_list)
+		{}
+	Binding_set_list& operator= (const Binding_set_list& rhs);
 	bool add_binding_set(const Binding_set& bs);
 	bool remove_binding_set(const Binding_set& bs);
 	bool add_binding_sets(const Binding_set_list& bsl);
@@ -31,8 +48,7 @@ public:
 	// return a list of binding sets that have wildcard binding pairs removed
 	Binding_set_list remove_wildcards() const;
 
-	void clear()
-		{return binding_set_list.clear();}
+	void clear();
 
 	bool empty() const
 		{return binding_set_list.empty();}
@@ -46,6 +62,33 @@ public:
 		
 private:
 	Binding_set_list_t binding_set_list;
+
+	typedef std::vector<Binding_set_list_t::const_iterator> Binding_set_it_vector_t;
+	// The binding sets whose values for the variables hash to the same key are in the
+	// same bucket, in list order. Binding sets that lack one of the variables are counted
+	// in n_unkeyed; if there are any, the index can't be used.
+	struct Value_index {
+		Symbol_list_t var_names;
+		std::unordered_map<std::size_t, Binding_set_it_vector_t> buckets;
+		std::size_t n_unkeyed;
+		};
+	typedef std::list<Value_index> Value_index_list_t;
+	mutable Value_index_list_t value_indexes;
+	enum {min_indexed_size = 8};	// shorter lists are simply scanned
+
+	// return the position of the binding set, or end() if it is not present
+	Binding_set_list_t::const_iterator find_binding_set(const Binding_set& bs) const;
+	// add to the end of the list, or erase, keeping the indexes up to date
+	void append(const Binding_set& bs);
+	void erase(Binding_set_list_t::const_iterator it);
+	// return the index on the variables, building it if necessary
+	Value_index& get_value_index(const Symbol_list_t& var_names) const;
+	// put the binding sets that could have the same values for the variables as the probe, 
+	// in list order, into candidates - all of them if the index can't be used
+	void get_candidates(const Binding_set& probe, const Symbol_list_t& var_names, 
+		Binding_set_it_vector_t& candidates) const;
+	// return the variable names present in the binding sets of both lists
+	static Symbol_list_t get_shared_var_names(const Binding_set_list& first, const Binding_set_list& second);
 	
 
 public:
@@ -89,20 +132,24 @@ bool add_combination_if_match_source (MT match_type,
 	const Binding_set_list& modification, const Binding_set_list& source, Binding_set_list& changes)
 {
 	Binding_set_list_t::const_iterator mod_it;
-	Binding_set_list_t::const_iterator source_it;
+	Binding_set_it_vector_t::const_iterator source_it;
+	Binding_set_it_vector_t candidates;
+	Symbol_list_t shared_var_names = get_shared_var_names(modification, source);
 	Binding_set result;	
 	bool changed = false;	// flag to return on whether there has been a change in the bindings
 	changes.clear();		// to ensure output is well defined
 		
-	for(mod_it = modification.binding_set_list.begin(); mod_it != modification.binding_set_list.end(); mod_it++)
-		for(source_it = source.binding_set_list.begin(); source_it != source.binding_set_list.end(); source_it++) {
-			result = match_type(*mod_it, *source_it);
+	for(mod_it = modification.binding_set_list.begin(); mod_it != modification.binding_set_list.end(); mod_it++) {
+		source.get_candidates(*mod_it, shared_var_names, candidates);
+		for(source_it = candidates.begin(); source_it != candidates.end(); source_it++) {
+			result = match_type(*mod_it, **source_it);
 			if (result) {
-				binding_set_list.push_back(result);
+				append(result);
 				changes.add_binding_set(result);
 				changed = true;
 				}
 			}
+		}
 	return changed;
 }
 			
@@ -113,20 +160,24 @@ bool add_mod_if_match_source (MT match_type,
 	const Binding_set_list& modification, const Binding_set_list& source, Binding_set_list& changes)
 {
 	Binding_set_list_t::const_iterator mod_it;
-	Binding_set_list_t::const_iterator source_it;
+	Binding_set_it_vector_t::const_iterator source_it;
+	Binding_set_it_vector_t candidates;
+	Symbol_list_t shared_var_names = get_shared_var_names(modification, source);
 	Binding_set result;	
 	bool changed = false;	// flag to return on whether there has been a change in the bindings
 	changes.clear();		// to ensure output is well defined
 		
-	for(mod_it = modification.binding_set_list.begin(); mod_it != modification.binding_set_list.end(); mod_it++)
-		for(source_it = source.binding_set_list.begin(); source_it != source.binding_set_list.end(); source_it++) {
-			result = match_type(*mod_it, *source_it);
+	for(mod_it = modification.binding_set_list.begin(); mod_it != modification.binding_set_list.end(); mod_it++) {
+		source.get_candidates(*mod_it, shared_var_names, candidates);
+		for(source_it = candidates.begin(); source_it != candidates.end(); source_it++) {
+			result = match_type(*mod_it, **source_it);
 			if (result) {
-				binding_set_list.push_back(*mod_it);
+				append(*mod_it);
 				changes.add_binding_set(*mod_it);
 				changed = true;
 				}
 			}
+		}
 	return changed;
 }
 			
@@ -138,22 +189,25 @@ bool add_mod_if_not_match_source (MT match_type,
 	const Binding_set_list& modification, const Binding_set_list& source, Binding_set_list& changes)
 {
 	Binding_set_list_t::const_iterator mod_it;
-	Binding_set_list_t::const_iterator source_it;
+	Binding_set_it_vector_t::const_iterator source_it;
+	Binding_set_it_vector_t candidates;
+	Symbol_list_t shared_var_names = get_shared_var_names(modification, source);
 	Binding_set result;	
 	bool changed = false;	// flag to return on whether there has been a change in the bindings
 	changes.clear();		// to ensure output is well defined
 		
 	for(mod_it = modification.binding_set_list.begin(); mod_it != modification.binding_set_list.end(); mod_it++) {
 		bool found = false;
-		for(source_it = source.binding_set_list.begin(); source_it != source.binding_set_list.end(); source_it++) {
-			result = match_type(*mod_it, *source_it);
+		source.get_candidates(*mod_it, shared_var_names, candidates);
+		for(source_it = candidates.begin(); source_it != candidates.end(); source_it++) {
+			result = match_type(*mod_it, **source_it);
 			if (result) {
 				found = true;
 				break;
 				}
 			}
 		if (!found) {
-			binding_set_list.push_back(*mod_it);
+			append(*mod_it);
 			changes.add_binding_set(*mod_it);
 			changed = true;
 			}
@@ -168,22 +222,27 @@ bool remove_if_match (MT match_type,
 	const Binding_set_list& modification, Binding_set_list& changes)
 {
 	Binding_set_list_t::const_iterator mod_it;
-	Binding_set_list_t::iterator this_it;
+	Binding_set_it_vector_t::const_iterator this_it;
+	Binding_set_it_vector_t candidates;
+	Binding_set_it_vector_t matches;
+	Symbol_list_t shared_var_names = get_shared_var_names(modification, *this);
 	Binding_set result;
 	bool changed = false;
 	changes.clear();		// to ensure output is well defined
 	
 	for(mod_it = modification.binding_set_list.begin(); mod_it != modification.binding_set_list.end(); mod_it++) {
-		this_it = binding_set_list.begin();
-		while (this_it != binding_set_list.end()) {
-			result = match_type(*mod_it, *this_it);
-			if(result) {
-				changes.add_binding_set(*this_it);
-				binding_set_list.erase(this_it++);	// erase using pre-increment value, then continue with increment
-				changed = true;
-				}
-			else
-				this_it++;
+		get_candidates(*mod_it, shared_var_names, candidates);
+		// collect the matches first, since erasing them changes the index
+		matches.clear();
+		for(this_it = candidates.begin(); this_it != candidates.end(); this_it++) {
+			result = match_type(*mod_it, **this_it);
+			if(result)
+				matches.push_back(*this_it);
+			}
+		for(this_it = matches.begin(); this_it != matches.end(); this_it++) {
+			changes.add_binding_set(**this_it);
+			erase(*this_it);
+			changed = true;
 			}
 		}
 	return changed;
@@ -28,7 +28,7 @@
 #include "Output_tee_globals.h"
 #include "Epic_standard_symbols.h"
 #include "Epic_exception.h"
-#include "Cognitive_event_types.h"
+#include "Cognitive_processor.h"
 #include "Assert_throw.h"
 #include "Random_utilities.h"
 
@@ -146,8 +146,8 @@ void Temporal_processor::reset_processor()
 		removal_description.push_back(Temporal_c);
 		removal_description.push_back(Ticks_c);
 		removal_description.push_back(Symbol(numTicks));
-		Coordinator::get_instance().schedule_event(new Cognitive_Delete_Clause_event(get_time(),
-			get_human_ptr()->get_cognitive_ptr(), removal_description));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_delete_clause(get_time(),
+			Clause(removal_description));
 	}
 
 	//	Indicate that there are no more "good" increment events currently in the queue.
@@ -178,8 +178,8 @@ void Temporal_processor::increment_ticks()
 			removal_description.push_back(Temporal_c);
 			removal_description.push_back(Ticks_c);
 			removal_description.push_back(Symbol(numTicks));
-			Coordinator::get_instance().schedule_event(new Cognitive_Delete_Clause_event(get_time(),
-				get_human_ptr()->get_cognitive_ptr(), removal_description));
+			get_human_ptr()->get_Cognitive_processor_ptr()->schedule_delete_clause(get_time(),
+				Clause(removal_description));
 		}
 	
 		// *** Add the new ticks to WM. ***
@@ -192,8 +192,8 @@ void Temporal_processor::increment_ticks()
 		add_description.push_back(Temporal_c);
 		add_description.push_back(Ticks_c);
 		add_description.push_back(Symbol(numTicks));
-		Coordinator::get_instance().schedule_event(new Cognitive_Add_Clause_event(get_time(),
-			get_human_ptr()->get_cognitive_ptr(), add_description));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_add_clause(get_time(),
+			Clause(add_description));
 
 		// *** Schedule the next tick to add to WM. ***
 
@@ -4,38 +4,74 @@
 #include "Output_tee.h"
 
 #include <iostream>
+#include <algorithm>
 
 
 using std::ostream;	using std::cout;	using std::cerr;	using std::endl;
 using std::map;	using std::less;	using std::pair;	using std::make_pair;
 using std::list;
+using std::lower_bound;
 
 
 /* PV_Container members */
 
+// comparison for finding where a new property belongs in property name order
+static bool property_name_less(const pair<Symbol, Symbol>& pv, const Symbol& property_name)
+{
+	return pv.first < property_name;
+}
+
 void PV_Container::store (const Symbol& property_name, const Symbol& property_value)
 {
 	// if property_value is Symbol(), the default value, erase the property name
-	if(property_value == Symbol())
-		p_v_con.erase(property_name);
+	if(property_value == Symbol()) {
+		erase(property_name);
+		return;
+		}
+	p_v_con_t::iterator it = find_property(property_name);
+	if(it != p_v_con.end())
+		(*it).second = property_value;
 	else
-		p_v_con[property_name] = property_value;
+		p_v_con.insert(lower_bound(p_v_con.begin(), p_v_con.end(), property_name, property_name_less),
+			make_pair(property_name, property_value));
 }
 
 void PV_Container::erase (const Symbol& property_name)
 {
-	p_v_con.erase(property_name);
+	p_v_con_t::iterator it = find_property(property_name);
+	if(it != p_v_con.end())
+		p_v_con.erase(it);
 }
 
 Symbol PV_Container::retrieve (const Symbol& property_name) const
 {
-	p_v_con_t::const_iterator it = p_v_con.find(property_name);
+	p_v_con_t::const_iterator it = find_property(property_name);
 	if (it == p_v_con.end() )
 		return Symbol();
 	else
 		return (*it).second;
 }
 
+PV_Container::p_v_con_t::iterator PV_Container::find_property(const Symbol& property_name)
+{
+	p_v_con_t::iterator it;
+	for (it = p_v_con.begin(); it != p_v_con.end(); ++it) {
+		if((*it).first == property_name)
+			break;
+		}
+	return it;
+}
+
+PV_Container::p_v_con_t::const_iterator PV_Container::find_property(const Symbol& property_name) const
+{
+	p_v_con_t::const_iterator it;
+	for (it = p_v_con.begin(); it != p_v_con.end(); ++it) {
+		if((*it).first == property_name)
+			break;
+		}
+	return it;
+}
+
 void PV_Container::get_pv_lists (Symbol_list_t & prop_names, Symbol_list_t& prop_values) const
 {
 	p_v_con_t::const_iterator it;
@@ -6,7 +6,9 @@ The objects have names stored in a Symbol, and associated with each object is a
 of properties, each with a value. The property names are represented by Symbols as are the Values. 
 
 A PV_Container is a property list - store a value under a property name, 
-supply the property name, and get a value back. 
+supply the property name, and get a value back. Since an object usually has only
+a handful of properties, they are kept in a vector in property name order, and looked
+up by a linear search that compares Symbols by identity rather than by their strings.
 
 An OPV_Container is a set of objects, each with an associated PV_container.
 Store or retrieve a value by supplying an object name and a property name.
@@ -21,6 +23,8 @@ Standard_utility_symbols.h
 
 #include <map>
 #include <list>
+#include <vector>
+#include <utility>
 #include <iosfwd>
 
 class Output_tee;
@@ -59,8 +63,11 @@ public:
 	friend std::ostream& operator<< (std::ostream& os, const PV_Container& pvc);
 			
 private:
-	typedef std::map<Symbol, Symbol> p_v_con_t;
-	p_v_con_t p_v_con;
+	typedef std::vector<std::pair<Symbol, Symbol> > p_v_con_t;
+	p_v_con_t p_v_con;	// kept in property name order
+
+	p_v_con_t::iterator find_property(const Symbol& prop_name);
+	p_v_con_t::const_iterator find_property(const Symbol& prop_name) const;
 };
 
 std::ostream& operator<< (std::ostream& os, const PV_Container& pvc);
@@ -33,16 +33,31 @@ Random_engine_t& get_Random_engine()
 */
 
 
+// Each thread has its own engine, so that simulations run in separate threads
+// have independent random sequences; the distributions are also per-thread
+// because they can hold state, such as the second value of a normal pair.
 Random_engine_t& get_Random_engine()
 {
-    static Random_engine_t engine;
+    static thread_local Random_engine_t engine;
     return engine;
 }
 
+namespace {
+thread_local std::uniform_int_distribution<int> uid;
+thread_local std::uniform_real_distribution<double> uurd(0., 1.);
+thread_local std::normal_distribution<double> und(0., 1.);
+thread_local std::normal_distribution<double> nd;
+}
 
+// the distributions are reset along with the engine, so that the random sequence
+// depends only on the seed and not on any values left over from before
 void set_random_number_generator_seed(unsigned long seed_)
 {
     get_Random_engine().seed(static_cast<Random_engine_t::result_type>(seed_));
+    uid.reset();
+    uurd.reset();
+    und.reset();
+    nd.reset();
 }
 
 /* Random variable generation - using C++11 <random> */
@@ -54,7 +69,6 @@ void set_random_number_generator_seed(unsigned long seed_)
 int random_int(int range)
 {
     // uniform_int_distribution returns a <= x <= b
-    static std::uniform_int_distribution<int> uid;
     using parm_t = decltype(uid)::param_type;
     int result = uid(get_Random_engine(), parm_t(0, range - 1));
     Assert(result != range);
@@ -70,7 +84,6 @@ bool biased_coin_flip(double p)
 
 double unit_uniform_random_variable()
 {
-    static std::uniform_real_distribution<double> uurd(0., 1.);
     return uurd(get_Random_engine());
 }
 
@@ -83,14 +96,12 @@ double uniform_random_variable(double mean, double deviation)
 
 double unit_normal_random_variable()
 {
-    static std::normal_distribution<double> und(0., 1.);
     return und(get_Random_engine());
 }
 
 
 double normal_random_variable(double mean, double sd)
 {
-    static std::normal_distribution<double> nd;
     using parm_t = decltype(nd)::param_type;
     return nd(get_Random_engine(), parm_t(mean, sd));
 }
@@ -21,6 +21,8 @@
 #include <cstring>
 #include <cstdio>
 #include <utility>	// for swap
+#include <algorithm>
+#include <functional>
 
 using std::ostream; using std::cerr; using std::endl;
 using std::set;
@@ -62,22 +64,28 @@ void Symbol::setup(const char * c, bool check_string_for_number)
 }
 
 
+// a single value is kept in the Symbol, in both x and y
 void Symbol::setup(double x_)
 {
-	vector<GU::Point> v(1, GU::Point(x_, x_));
-	// set up a single value
-	vec_rep_ptr = Symbol_memory::get_instance().find_or_insert(true, v);
+	numeric.value = GU::Point(x_, x_);
+	numeric_kind = SINGLE_VALUE;
 }
 	
 void Symbol::setup(GU::Point p)
 {
-	vector<GU::Point> v(1, p);
-	vec_rep_ptr = Symbol_memory::get_instance().find_or_insert(false, v);
+	numeric.value = p;
+	numeric_kind = POINT_VALUE;
 }
-	
+
+// a vector of just one Point is the same as a single Point
 void Symbol::setup(const vector<GU::Point>& v_)
 {
-	vec_rep_ptr = Symbol_memory::get_instance().find_or_insert(false, v_);
+	if(v_.size() == 1) {
+		setup(v_[0]);
+		return;
+		}
+	numeric.vec_rep_ptr = Symbol_memory::get_instance().find_or_insert(v_);
+	numeric_kind = VECTOR_VALUE;
 }
 
 		
@@ -88,19 +96,18 @@ Symbol::~Symbol()
 		Symbol_memory::get_instance().remove_if_last(str_rep_ptr);
 		}
 	// ditto if it has a vector
-	if(vec_rep_ptr) {
-		Symbol_memory::get_instance().remove_if_last(vec_rep_ptr);
+	if(numeric_kind == VECTOR_VALUE) {
+		Symbol_memory::get_instance().remove_if_last(numeric.vec_rep_ptr);
 		}
 }
 
-Symbol::Symbol(const Symbol& src)
+Symbol::Symbol(const Symbol& src) :
+	str_rep_ptr(src.str_rep_ptr), numeric(src.numeric), numeric_kind(src.numeric_kind)
 {
-	str_rep_ptr = src.str_rep_ptr;
 	if(str_rep_ptr)
 		(str_rep_ptr->count)++;
-	vec_rep_ptr = src.vec_rep_ptr;
-	if(vec_rep_ptr)
-		(vec_rep_ptr->count)++;
+	if(numeric_kind == VECTOR_VALUE)
+		(numeric.vec_rep_ptr->count)++;
 }
 	
 // uses copy-swap
@@ -115,7 +122,8 @@ const Symbol& Symbol::operator= (const Symbol& rhs)
 void Symbol::swap(Symbol& other)
 {
 	std::swap(str_rep_ptr, other.str_rep_ptr);
-	std::swap(vec_rep_ptr, other.vec_rep_ptr);
+	std::swap(numeric, other.numeric);
+	std::swap(numeric_kind, other.numeric_kind);
 }
 
 // assign from a C-string
@@ -135,12 +143,12 @@ const Symbol& Symbol::operator= (double rhs)
 
 bool Symbol::has_single_numeric_value() const 
 {
-	return vec_rep_ptr && vec_rep_ptr->single;
+	return numeric_kind == SINGLE_VALUE;
 }
 
 bool Symbol::has_Point_numeric_value() const 
 {
-	return vec_rep_ptr && !(vec_rep_ptr->single) && (vec_rep_ptr->vec.size() == 1);
+	return numeric_kind == POINT_VALUE;
 }
 
 bool Symbol::has_pair_numeric_value() const 
@@ -150,7 +158,22 @@ bool Symbol::has_pair_numeric_value() const
 
 bool Symbol::has_multiple_numeric_value() const 
 {
-	return vec_rep_ptr && (vec_rep_ptr->vec.size() > 2);
+	return numeric_kind == VECTOR_VALUE && (numeric.vec_rep_ptr->vec.size() > 2);
+}
+
+// the inline value is an array of one Point
+const GU::Point * Symbol::get_numeric_data() const
+{
+	if(numeric_kind == VECTOR_VALUE)
+		return numeric.vec_rep_ptr->vec.empty() ? 0 : &(numeric.vec_rep_ptr->vec[0]);
+	return &numeric.value;
+}
+
+size_t Symbol::get_numeric_size() const
+{
+	if(numeric_kind == VECTOR_VALUE)
+		return numeric.vec_rep_ptr->vec.size();
+	return (numeric_kind == NO_NUMBER) ? 0 : 1;
 }
 
 
@@ -190,35 +213,37 @@ string Symbol::str() const
 double Symbol::get_numeric_value() const
 {
 	if(has_single_numeric_value())
-		return vec_rep_ptr->vec[0].x;
+		return numeric.value.x;
 	throw Symbol_exception("Symbol is not single numeric value");
 }
 
 GU::Point Symbol::get_Point() const
 {
 	if(has_Point_numeric_value())
-		return vec_rep_ptr->vec[0];
+		return numeric.value;
 	throw Symbol_exception("Symbol is not a Point numeric value");
 }
 
 double Symbol::get_x() const
 {
 	if(has_pair_numeric_value())
-		return vec_rep_ptr->vec[0].x;
+		return numeric.value.x;
 	throw Symbol_exception("Symbol is not a pair numeric value");
 }
 
 double Symbol::get_y() const
 {
 	if(has_pair_numeric_value())
-		return vec_rep_ptr->vec[0].y;
+		return numeric.value.y;
 	throw Symbol_exception("Symbol is not a pair numeric value");
 }
 
-const vector<GU::Point>& Symbol::get_Point_vector() const
+vector<GU::Point> Symbol::get_Point_vector() const
 {
+	if(numeric_kind == VECTOR_VALUE)
+		return numeric.vec_rep_ptr->vec;
 	if(has_numeric_value())
-		return vec_rep_ptr->vec;
+		return vector<GU::Point>(1, numeric.value);
 	throw Symbol_exception("Symbol is not a vector value");
 }
 	
@@ -257,8 +282,11 @@ bool Symbol::operator< (const Symbol& rhs) const
 			return (strcmp(str_rep_ptr->cstr, rhs.str_rep_ptr->cstr) < 0);
 		}
 	// no strings, just numbers
-	//Assert(vec_rep_ptr && rhs.vec_rep_ptr);
-	return vec_rep_ptr->vec < rhs.vec_rep_ptr->vec;
+	// compared as vectors of Points, whether inline or not
+	const GU::Point * data = get_numeric_data();
+	const GU::Point * rhs_data = rhs.get_numeric_data();
+	return std::lexicographical_compare(data, data + get_numeric_size(), 
+		rhs_data, rhs_data + rhs.get_numeric_size());
 }
 
 
@@ -387,6 +415,22 @@ bool operator> (double lhs, const Symbol& rhs)
 bool operator>= (double lhs, const Symbol& rhs) 
 	{return (rhs.has_numeric_value()) ? (rhs.get_numeric_value() >= lhs) : false;}
 	
+// Equal Symbols have the same reps and kind of inline value, and equal inline values;
+// a zero value is hashed as +0. because -0. compares equal to it.
+size_t Symbol::hash() const
+{
+	std::hash<const void *> hash_ptr;
+	std::hash<double> hash_double;
+	size_t result = hash_ptr(str_rep_ptr);
+	result = result * 31 + hash_ptr((numeric_kind == VECTOR_VALUE) ? numeric.vec_rep_ptr : 0);
+	result = result * 31 + size_t(numeric_kind);
+	if(numeric_kind == SINGLE_VALUE || numeric_kind == POINT_VALUE) {
+		result = result * 31 + hash_double(numeric.value.x == 0. ? 0. : numeric.value.x);
+		result = result * 31 + hash_double(numeric.value.y == 0. ? 0. : numeric.value.y);
+		}
+	return result;
+}
+
 // output operators
 ostream& operator<< (ostream& os, const Symbol& s) 
 {
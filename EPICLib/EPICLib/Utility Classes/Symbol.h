@@ -14,14 +14,20 @@ are a single value, a single Point, or a vector of Points.
 If both string and numeric values are present, the Symbol serves as a "named value" - especially
 useful if the value is a vector of many Points.
 
-The strings and numeric values are stored as unique reference counted objects. New values
+The strings and vectors of Points are stored as unique reference counted objects. New values
 are compared to the stored values, and re-used if they match. 
 
 Creating, copying, assigning, destroying increment/decrement the reference count for
 a value; if the reference count goes to zero, the string or number object id deleted.
 
+A single value or a single Point is not stored in memory, but held directly in the Symbol
+along with a code for which kind of numeric value it is. Two such Symbols are equal if they have
+the same kind of value and the values are equal, just as if they were shared in memory.
+The inline value shares its space with the pointer to a stored vector, since a Symbol
+holds only one kind of numeric value.
+
 The whole goal of this class is to enable copy & assignment to be done with shallow copy and 
-equality comparison to be done with only pointer comparison. Ordering comparison
+equality comparison to be done with only pointer and value comparison. Ordering comparison
 is slowed down by the indirection. Since the strings and numeric value cannot be modified, 
 no time is wasted on copying values, but the lookup for previous matching values slows down
 creation of new values.
@@ -49,6 +55,7 @@ value of the symbol or the numeric value as written with the output operator.
 #include <string>	// for interface with strings
 #include <vector>	// for interface with vectors
 #include <list>		// for typedefs and operators for lists of Symbols
+#include <cstddef>
 
 class Symbol_exception : public Exception {
 public:
@@ -67,39 +74,39 @@ public:
 // defining const Symbols as much as possible for speed, but there are many
 // cases were the string is likely to be unique. Explicit remomved 7/30/06
 	Symbol(const char * c = "Nil", bool check_for_number = true)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(c, check_for_number);}
 
 	Symbol(const std::string& s, bool check_for_number = true)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(s.c_str(), check_for_number);}
 
 	Symbol(double in_x)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(in_x);}
 
 	Symbol(int in_x)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(double(in_x));}
 
 	Symbol(long in_x)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(double(in_x));}
 
 	Symbol(double in_x, double in_y)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(GU::Point(in_x, in_y));}
 
 	Symbol(GU::Point p)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(p);}
 
 	Symbol(const std::vector<GU::Point>& v)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(v);}
 
 	Symbol(const char * c, const std::vector<GU::Point>& v)
-		: str_rep_ptr(0), vec_rep_ptr(0)
+		: str_rep_ptr(0), numeric_kind(NO_NUMBER)
 		{setup(c, false); setup(v);}
 
 	~Symbol();
@@ -116,7 +123,7 @@ public:
 	bool has_string_value() const
 		{return str_rep_ptr;}
 	bool has_numeric_value() const
-		{return vec_rep_ptr;}
+		{return numeric_kind != NO_NUMBER;}
 	bool has_single_numeric_value() const;
 	bool has_Point_numeric_value() const;
 	bool has_pair_numeric_value() const;
@@ -134,8 +141,9 @@ public:
 	// get x or y part of a pair of values
 	double get_x() const;	// must be a single Point present
 	double get_y() const;	// must be a single Point present
-	// get the vector of Points
-	const std::vector<GU::Point>& get_Point_vector() const;	// must be any numeric value
+	// get a copy of the vector of Points; returned by value because a single value
+	// or Point is held in the Symbol and has no stored vector to refer to
+	std::vector<GU::Point> get_Point_vector() const;	// must be any numeric value
 
 
 /* Comparisons
@@ -187,15 +195,29 @@ Comparisons with non-Symbol types follow the corresponding rules
 	friend bool operator>= (double lhs, const Symbol& rhs);
 
 	friend std::ostream& operator<< (std::ostream&, const Symbol&);
+
+	// a hash value consistent with operator==, for use in unordered containers
+	std::size_t hash() const;
 			
 private:
+	enum Numeric_kind_e {NO_NUMBER, SINGLE_VALUE, POINT_VALUE, VECTOR_VALUE};
 	Symbol_memory_Str_rep * str_rep_ptr;	// zero if no string value is present
-	Symbol_memory_Vec_rep * vec_rep_ptr;	// zero if no numeric value is present
-	//	str_rep_ptr	vec_rep_ptr		contents of this Symbol
-	//	!= 0		0				string only - comparisons done on strings
-	//	0			!= 0			numeric value(s) only - comparisons done on values
-	//	!= 0		!= 0			"named values" - comparisons done on strings
-	//	0			0				not possible
+	// numeric_kind says which member of the numeric union is in use
+	union Numeric_u {
+		Symbol_memory_Vec_rep * vec_rep_ptr;	// a VECTOR_VALUE
+		GU::Point value;						// the SINGLE_VALUE (in both x and y) or POINT_VALUE
+		Numeric_u() : vec_rep_ptr(0) {}
+	} numeric;
+	Numeric_kind_e numeric_kind;
+	//	str_rep_ptr	numeric_kind	contents of this Symbol
+	//	!= 0		NO_NUMBER		string only - comparisons done on strings
+	//	0			not NO_NUMBER	numeric value(s) only - comparisons done on values
+	//	!= 0		not NO_NUMBER	"named values" - comparisons done on strings
+	//	0			NO_NUMBER		not possible
+
+	// the numeric value as an array of Points, and how many there are
+	const GU::Point * get_numeric_data() const;
+	std::size_t get_numeric_size() const;
 
 	// setup a Symbol from a supplied c-string
 	void setup(const char * c, bool check_for_number);
@@ -208,9 +230,15 @@ private:
 // following inlined here for speed given possible uses in containers and algorithms
 inline bool Symbol::operator== (const Symbol& rhs) const
 {	
-	// to be equal, both pointers must be equal
-	// equal if pointing to the same value or are zero	
-	return (str_rep_ptr == rhs.str_rep_ptr) && (vec_rep_ptr == rhs.vec_rep_ptr);
+	// to be equal, the string pointers must be equal, and the numeric values
+	// must be the same kind, with equal inline values or the same vector
+	if(str_rep_ptr != rhs.str_rep_ptr || numeric_kind != rhs.numeric_kind)
+		return false;
+	if(numeric_kind == VECTOR_VALUE)
+		return numeric.vec_rep_ptr == rhs.numeric.vec_rep_ptr;
+	if(numeric_kind == NO_NUMBER)
+		return true;
+	return numeric.value == rhs.numeric.value;
 }
 
 inline bool Symbol::operator!= (const Symbol& rhs) const
@@ -220,6 +248,12 @@ inline bool Symbol::operator!= (const Symbol& rhs) const
 
 std::ostream& operator<< (std::ostream&, const Symbol&);
 
+// function object class for hashing Symbols
+struct Symbol_hash {
+	std::size_t operator() (const Symbol& s) const
+		{return s.hash();}
+};
+
 typedef std::list<Symbol> Symbol_list_t;
 
 
@@ -3,17 +3,25 @@
 #include "Assert_throw.h"
 #include <cstddef>
 #include <algorithm>
+#include <cstdint>
+#include <new>
 
+using std::atomic;
+using std::lock_guard;
+using std::mutex;
 using std::vector;
 using std::set;
-using std::strcpy;
+using std::memcmp;	using std::memcpy;
+using std::uint64_t;
 using std::size_t;
 
 Symbol_memory * Symbol_memory::Symbol_memory_ptr = 0;
 
 // A Meyers singleton would get automatically destructed, which is not
 // a good idea because the individual Symbols might get destructed afterwards
-// everything should get freed except for the final empty container
+// everything should get freed except for the final empty container.
+// The first call happens while the standard Symbols are being initialized,
+// before any additional threads can have been started.
 Symbol_memory& Symbol_memory::get_instance()
 {
 	if(!Symbol_memory_ptr)
@@ -28,13 +36,20 @@ void Symbol_memory::clear()
 	for_each(vec_rep_ptr_set.begin(), vec_rep_ptr_set.end(), Delete());
 	vec_rep_ptr_set.clear();
 	
-	for(Str_rep_ptr_set_t::iterator it = str_rep_ptr_set.begin(); it != str_rep_ptr_set.end(); it++) {
-		Symbol_memory_Str_rep * p = *it;
-		delete[] p->cstr;
-		delete p;
+	for(int i = 0; i < n_str_shards; i++)
+		str_shards[i].clear();
+}
+
+// FNV-1a hash of the characters
+size_t Symbol_memory::hash_string(const char * p, int len)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for(int i = 0; i < len; i++) {
+		hash ^= static_cast<unsigned char>(p[i]);
+		hash *= 1099511628211ULL;
 		}
-	// deallocate the set contents
-	str_rep_ptr_set.clear();
+	// fold the high bits in for a 32-bit size_t
+	return size_t(hash ^ (hash >> 32));
 }
 
 // return the pointer to the Symbol_memory_Str_rep if the cstring is already present, 
@@ -42,29 +57,178 @@ void Symbol_memory::clear()
 // len is supplied because it is already computed - to save time
 Symbol_memory_Str_rep * Symbol_memory::find_or_insert(const char * p, int len)
 {
-	Symbol_memory_Str_rep sr(0, p, 0);
-	Str_rep_ptr_set_t::iterator it = str_rep_ptr_set.find(&sr);
-	if (it == str_rep_ptr_set.end()) {
-		char * cp = new char[len + 1];
-		strcpy(cp, p);
-		Symbol_memory_Str_rep * str_rep_ptr = new Symbol_memory_Str_rep(1, cp, len);
-		str_rep_ptr_set.insert(str_rep_ptr);
-		return str_rep_ptr;
+	size_t hash = hash_string(p, len);
+	return get_str_shard(hash).find_or_insert(p, len, hash);
+}
+
+// decrement the reference count; remove it and free the memory if it was the last use
+void Symbol_memory::remove_if_last(Symbol_memory_Str_rep * str_rep_ptr)
+{
+	if(release_if_not_last(str_rep_ptr->count))
+		return;
+	get_str_shard(str_rep_ptr->hash).remove_if_last(str_rep_ptr);
+}
+
+Symbol_memory::Str_shard::Str_shard() :
+	slots(initial_n_slots, 0), n_reps(0), chunk_next(0), chunk_end(0)
+{
+	for(int i = 0; i < n_size_classes; i++)
+		free_lists[i] = 0;
+}
+
+Symbol_memory_Str_rep * Symbol_memory::Str_shard::find_or_insert(const char * p, int len, size_t hash)
+{
+	lock_guard<mutex> lock(shard_mutex);
+	size_t mask = slots.size() - 1;
+	for(size_t i = hash & mask; slots[i]; i = (i + 1) & mask) {
+		Symbol_memory_Str_rep * str_rep_ptr = slots[i];
+		if(str_rep_ptr->hash == hash && str_rep_ptr->cstr_len == size_t(len) && 
+			memcmp(str_rep_ptr->cstr, p, len) == 0) {
+			// increment the count
+			(str_rep_ptr->count)++;
+			return str_rep_ptr;
+			}
 		}
-	else {
-		Symbol_memory_Str_rep * str_rep_ptr = *it;
-		// increment the count
-		(str_rep_ptr->count)++;
-		return str_rep_ptr;
+	// not present - put the Str_rep and the characters in one block
+	char * block = static_cast<char *>(allocate(get_block_size(len)));
+	char * cp = block + sizeof(Symbol_memory_Str_rep);
+	memcpy(cp, p, len);
+	cp[len] = '\0';
+	Symbol_memory_Str_rep * str_rep_ptr = new (block) Symbol_memory_Str_rep(1, cp, len, hash);
+	if(2 * (n_reps + 1) > slots.size())
+		grow();
+	insert_slot(str_rep_ptr);
+	n_reps++;
+	return str_rep_ptr;
+}
+
+// the count might have been incremented by find_or_insert after release_if_not_last
+void Symbol_memory::Str_shard::remove_if_last(Symbol_memory_Str_rep * str_rep_ptr)
+{
+	lock_guard<mutex> lock(shard_mutex);
+	if(--(str_rep_ptr->count) == 0) {
+		erase_slot(get_slot(str_rep_ptr));
+		n_reps--;
+		size_t block_size = get_block_size(str_rep_ptr->cstr_len);
+		str_rep_ptr->~Symbol_memory_Str_rep();
+		deallocate(str_rep_ptr, block_size);
 		}
 }
 
-Symbol_memory_Vec_rep * Symbol_memory::find_or_insert(bool single_, const std::vector<GU::Point>& v_)
+void Symbol_memory::Str_shard::clear()
 {
-	Symbol_memory_Vec_rep vr(0, single_, v_);
+	for(size_t i = 0; i < slots.size(); i++) {
+		Symbol_memory_Str_rep * str_rep_ptr = slots[i];
+		if(!str_rep_ptr)
+			continue;
+		size_t block_size = get_block_size(str_rep_ptr->cstr_len);
+		str_rep_ptr->~Symbol_memory_Str_rep();
+		if(block_size > max_pooled_size)
+			::operator delete(str_rep_ptr);
+		slots[i] = 0;
+		}
+	n_reps = 0;
+	for(size_t i = 0; i < chunks.size(); i++)
+		::operator delete(chunks[i]);
+	chunks.clear();
+	chunk_next = chunk_end = 0;
+	for(int i = 0; i < n_size_classes; i++)
+		free_lists[i] = 0;
+}
+
+// return the index of the slot holding the Str_rep, which must be present
+size_t Symbol_memory::Str_shard::get_slot(Symbol_memory_Str_rep * str_rep_ptr) const
+{
+	size_t mask = slots.size() - 1;
+	size_t i = str_rep_ptr->hash & mask;
+	while(slots[i] != str_rep_ptr) {
+		Assert(slots[i]);
+		i = (i + 1) & mask;
+		}
+	return i;
+}
+
+// put the Str_rep in the first empty slot at or after its home slot
+void Symbol_memory::Str_shard::insert_slot(Symbol_memory_Str_rep * str_rep_ptr)
+{
+	size_t mask = slots.size() - 1;
+	size_t i = str_rep_ptr->hash & mask;
+	while(slots[i])
+		i = (i + 1) & mask;
+	slots[i] = str_rep_ptr;
+}
+
+// empty the slot, then move back any following Str_reps in the same run that
+// would no longer be reachable from their home slots
+void Symbol_memory::Str_shard::erase_slot(size_t i)
+{
+	size_t mask = slots.size() - 1;
+	size_t j = i;
+	while(true) {
+		j = (j + 1) & mask;
+		if(!slots[j])
+			break;
+		size_t home = slots[j]->hash & mask;
+		// move slots[j] into the hole at i unless its home lies cyclically in (i, j]
+		bool home_in_range = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+		if(!home_in_range) {
+			slots[i] = slots[j];
+			i = j;
+			}
+		}
+	slots[i] = 0;
+}
+
+void Symbol_memory::Str_shard::grow()
+{
+	vector<Symbol_memory_Str_rep *> old_slots(2 * slots.size(), 0);
+	old_slots.swap(slots);
+	for(size_t i = 0; i < old_slots.size(); i++)
+		if(old_slots[i])
+			insert_slot(old_slots[i]);
+}
+
+void * Symbol_memory::Str_shard::allocate(size_t size)
+{
+	if(size > max_pooled_size)
+		return ::operator new(size);
+	size_t size_class = get_size_class(size);
+	Free_block * block_ptr = free_lists[size_class];
+	if(block_ptr) {
+		free_lists[size_class] = block_ptr->next;
+		return block_ptr;
+		}
+	// take the block from the current chunk, starting a new chunk if there is not enough left
+	size_t block_size = (size_class + 1) * granularity;
+	if(size_t(chunk_end - chunk_next) < block_size) {
+		chunk_next = static_cast<char *>(::operator new(chunk_size));
+		chunk_end = chunk_next + chunk_size;
+		chunks.push_back(chunk_next);
+		}
+	void * p = chunk_next;
+	chunk_next += block_size;
+	return p;
+}
+
+void Symbol_memory::Str_shard::deallocate(void * p, size_t size)
+{
+	if(size > max_pooled_size) {
+		::operator delete(p);
+		return;
+		}
+	size_t size_class = get_size_class(size);
+	Free_block * block_ptr = static_cast<Free_block *>(p);
+	block_ptr->next = free_lists[size_class];
+	free_lists[size_class] = block_ptr;
+}
+
+Symbol_memory_Vec_rep * Symbol_memory::find_or_insert(const std::vector<GU::Point>& v_)
+{
+	lock_guard<mutex> lock(vec_rep_mutex);
+	Symbol_memory_Vec_rep vr(0, v_);
 	Vec_rep_ptr_set_t::iterator it = vec_rep_ptr_set.find(&vr);
 	if (it == vec_rep_ptr_set.end()) {
-		Symbol_memory_Vec_rep * vec_rep_ptr = new Symbol_memory_Vec_rep(1, single_, v_);
+		Symbol_memory_Vec_rep * vec_rep_ptr = new Symbol_memory_Vec_rep(1, v_);
 		vec_rep_ptr_set.insert(vec_rep_ptr);
 		return vec_rep_ptr;
 		}
@@ -76,24 +240,26 @@ Symbol_memory_Vec_rep * Symbol_memory::find_or_insert(bool single_, const std::v
 		}
 }
 
-// decrement the reference count; remove it and free the memory if it was the last use
-void Symbol_memory::remove_if_last(Symbol_memory_Str_rep * str_rep_ptr)
+// If the count is more than one, another Symbol refers to the rep, so the count
+// can be decremented without locking. Otherwise this is the only Symbol using the rep; 
+// the count can then be increased only by find_or_insert, which needs the lock.
+bool Symbol_memory::release_if_not_last(atomic<long>& count)
 {
-	(str_rep_ptr->count)--;
-	if(str_rep_ptr->count == 0) {
-		// remove it from the set
-		Str_rep_ptr_set_t::iterator it = str_rep_ptr_set.find(str_rep_ptr);
-		Assert(it != str_rep_ptr_set.end());
-		str_rep_ptr_set.erase(it);
-		delete str_rep_ptr;
+	long old_count = count.load();
+	while(old_count > 1) {
+		if(count.compare_exchange_weak(old_count, old_count - 1))
+			return true;
 		}
+	return false;
 }
 
 // decrement the reference count; remove it and free the memory if it was the last use
 void Symbol_memory::remove_if_last(Symbol_memory_Vec_rep * vec_rep_ptr)
 {
-	(vec_rep_ptr->count)--;
-	if(vec_rep_ptr->count == 0) {
+	if(release_if_not_last(vec_rep_ptr->count))
+		return;
+	lock_guard<mutex> lock(vec_rep_mutex);
+	if(--(vec_rep_ptr->count) == 0) {
 		// remove it from the set
 		Vec_rep_ptr_set_t::iterator it = vec_rep_ptr_set.find(vec_rep_ptr);
 		Assert(it != vec_rep_ptr_set.end());
@@ -4,65 +4,62 @@
 #include "Point.h"
 #include <vector>
 #include <cstring>
+#include <cstddef>
 #include <set>
+#include <atomic>
+#include <mutex>
 
 namespace GU = Geometry_Utilities;
 
 // A class for keeping reference-counted strings
+// The characters are stored right after the Str_rep in the same block of memory,
+// and the hash of the string is saved for lookup and removal.
 class Symbol_memory_Str_rep {
 public:
-	Symbol_memory_Str_rep(long count_, const char * cstr_, int cstr_len_) :
-		count(count_), cstr(cstr_), cstr_len(cstr_len_)
+	Symbol_memory_Str_rep(long count_, const char * cstr_, int cstr_len_, std::size_t hash_) :
+		count(count_), cstr(cstr_), cstr_len(cstr_len_), hash(hash_)
 		{}
 	friend class Symbol;
 	friend class Symbol_memory;
-	friend struct Symbol_memory_less_Str_rep;
 private:
-	long count;
+	std::atomic<long> count;
 	const char * cstr;
 	size_t cstr_len;
-};
-
-// function object class for ordering Str_reps
-struct Symbol_memory_less_Str_rep {
-	bool operator() (const Symbol_memory_Str_rep * lhs, const Symbol_memory_Str_rep * rhs) const
-		{
-			return (std::strcmp(lhs->cstr, rhs->cstr) < 0);
-		}
+	std::size_t hash;
 };
 
 // A class for keeping reference-counted vectors of Points
+// Single values and single Points are kept inline in the Symbol instead
 class Symbol_memory_Vec_rep {
 public:
-	Symbol_memory_Vec_rep(long count_, bool single_, const std::vector<GU::Point>& v_) :
-		count(count_), single(single_), vec(v_)
+	Symbol_memory_Vec_rep(long count_, const std::vector<GU::Point>& v_) :
+		count(count_), vec(v_)
 		{}
 	friend class Symbol;
 	friend class Symbol_memory;
 	friend struct Symbol_memory_less_Vec_rep;
 private:
-	long count;
-	bool single;	// true if only a single value (not a pair) is stored
+	std::atomic<long> count;
 	const std::vector<GU::Point> vec;
 };
 
 // function object class for ordering Vec_reps
-// single value is less than non-single
 struct Symbol_memory_less_Vec_rep {
 	bool operator() (const Symbol_memory_Vec_rep * lhs, const Symbol_memory_Vec_rep * rhs) const
 		{
-			if(lhs->single == rhs->single)
-				return (lhs->vec < rhs->vec);
-			else if (lhs->single && !(rhs->single))
-				return true;
-			else
-				return false;
+			return (lhs->vec < rhs->vec);
 		}
 };
 
 
 // This singleton class encapsulates a container for Str_reps and Vec_reps
-// It is used by the Symbol class, hence most of the members are private
+// It is used by the Symbol class, hence most of the members are private.
+// It is shared by all threads: the reference counts are atomic, so that Symbols can be
+// copied and destroyed without locking, and the containers are protected by mutexes
+// that are locked only to find or insert a rep, or to remove one when its last use goes away.
+// The Str_reps are kept in an open-addressing hash table split into shards by the string hash; 
+// each shard has its own mutex and its own slab of memory for the Str_reps and their characters,
+// so threads interning different strings seldom wait for each other.
 class Symbol_memory {
 public:
 	static Symbol_memory& get_instance();
@@ -82,6 +79,10 @@ private:
 	
 	// deallocate all of the memory.
 	void clear();
+
+	// decrement the count and return true if it was not the last reference;
+	// if it was the last, leave the count unchanged and return false.
+	static bool release_if_not_last(std::atomic<long>& count);
 		
 	// return the pointer to the Symbol_memory_Str_rep if the cstring is already present, 
 	// add the Symbol_memory_Str_rep if it isn't, and return the pointer
@@ -92,18 +93,65 @@ private:
 	// longer in use
 	void remove_if_last(Symbol_memory_Str_rep *);
 
-	typedef std::set<Symbol_memory_Str_rep *, Symbol_memory_less_Str_rep> Str_rep_ptr_set_t;
-	Str_rep_ptr_set_t str_rep_ptr_set;
-	std::size_t total_Str_rep_size;
+	// One shard of the Str_rep hash table. The slots are a power of two in number,
+	// probed linearly from the hash, and zero if empty; the table is kept at most half full.
+	// Blocks for the Str_reps are carved out of chunks and re-used from a free list
+	// for each size class, as in Event_pool; larger blocks are allocated normally.
+	class Str_shard {
+	public:
+		Str_shard();
+		~Str_shard()
+			{clear();}
+		Symbol_memory_Str_rep * find_or_insert(const char * p, int len, std::size_t hash);
+		void remove_if_last(Symbol_memory_Str_rep * str_rep_ptr);
+		void clear();
+	private:
+		enum {initial_n_slots = 64, granularity = 16, max_pooled_size = 256, 
+			n_size_classes = max_pooled_size / granularity, chunk_size = 16 * 1024};
+		struct Free_block {
+			Free_block * next;
+			};
+		std::mutex shard_mutex;
+		std::vector<Symbol_memory_Str_rep *> slots;
+		std::size_t n_reps;
+		Free_block * free_lists[n_size_classes];
+		std::vector<char *> chunks;
+		char * chunk_next;
+		char * chunk_end;
+
+		std::size_t get_slot(Symbol_memory_Str_rep * str_rep_ptr) const;
+		void insert_slot(Symbol_memory_Str_rep * str_rep_ptr);
+		void erase_slot(std::size_t i);
+		void grow();
+		void * allocate(std::size_t size);
+		void deallocate(void * p, std::size_t size);
+		static std::size_t get_size_class(std::size_t size)
+			{return (size - 1) / granularity;}
+		static std::size_t get_block_size(std::size_t cstr_len)
+			{return sizeof(Symbol_memory_Str_rep) + cstr_len + 1;}
+		Str_shard(const Str_shard&);
+		Str_shard& operator= (const Str_shard&);
+	};
+
+	enum {n_str_shards = 16};
+	Str_shard str_shards[n_str_shards];
+
+	static std::size_t hash_string(const char * p, int len);
+	Str_shard& get_str_shard(std::size_t hash)
+		// the shard is picked with the high bits, the slot with the low bits
+		{return str_shards[(hash >> (sizeof(std::size_t) * 8 - 4)) % n_str_shards];}
 	
 	// Return the pointer to the Symbol_memory_Vec_rep if it is already present, 
 	// add the Symbol_memory_Vec_rep if it isn't, and return the pointer
-	Symbol_memory_Vec_rep * find_or_insert(bool single_, const std::vector<GU::Point>& v_);
+	Symbol_memory_Vec_rep * find_or_insert(const std::vector<GU::Point>& v_);
 			
 	// decrement reference count for pointed-to string, and deallocate it if no
 	// longer in use
 	void remove_if_last(Symbol_memory_Vec_rep *);
 
+	// protects the Vec_rep container
+	std::mutex vec_rep_mutex;
+
 	// Not clear that there  is any advantage to keeping a uniquified container of Vec_reps
 	// that are shared between Symbols ...
 	typedef std::set<Symbol_memory_Vec_rep *, Symbol_memory_less_Vec_rep> Vec_rep_ptr_set_t;
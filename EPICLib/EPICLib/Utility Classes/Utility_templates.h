@@ -19,4 +19,42 @@ void operator() (const T thePair) const
 	}
 };
 
+/* Map_value_range presents the values of a map as a range suitable for a range-based for loop,
+without copying them. Like any iterator into the map, the range is invalidated if an element
+of the map is erased while it is in use. */
+template<typename Map_t>
+class Map_value_range {
+public:
+	class const_iterator {
+	public:
+		const_iterator(typename Map_t::const_iterator it_) : it(it_)
+			{}
+		const typename Map_t::mapped_type& operator* () const
+			{return it->second;}
+		const typename Map_t::mapped_type * operator-> () const
+			{return &(it->second);}
+		const_iterator& operator++ ()
+			{++it; return *this;}
+		bool operator== (const const_iterator& rhs) const
+			{return it == rhs.it;}
+		bool operator!= (const const_iterator& rhs) const
+			{return it != rhs.it;}
+	private:
+		typename Map_t::const_iterator it;
+	};
+	
+	Map_value_range(const Map_t& container_) : container(container_)
+		{}
+	const_iterator begin() const
+		{return const_iterator(container.begin());}
+	const_iterator end() const
+		{return const_iterator(container.end());}
+	bool empty() const
+		{return container.empty();}
+	typename Map_t::size_type size() const
+		{return container.size();}
+private:
+	const Map_t& container;
+};
+
 #endif
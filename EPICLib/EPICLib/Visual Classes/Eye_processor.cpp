@@ -90,9 +90,12 @@ issue. Need to keep track of what properties of an object are available and what
 
 using std::string;
 using std::list;
+using std::sort;
+using std::unique;
 using std::endl;
 using std::shared_ptr;
 using std::make_shared;
+using std::make_pair;
 
 /*** Exception classes ***/
 // these are user-interpretable errors
@@ -189,6 +192,9 @@ void Eye_processor::initialize()
 	eye_movement_complete_time = 0;
 	closest_object_ptr = 0;	// current object closest to point of fixation
 	closest_eccentricity = 0.;
+	invalidate_nearest_object();
+	visible_objects.clear();
+	names_removed.clear();
 	centering_enabled = false;
 	centering_on= false;
 	centering_active= false;
@@ -220,6 +226,7 @@ void Eye_processor::set_parameter(const Parameter_specification& param_spec)
 		Visual_physical_store& physical_store = *(get_human_ptr()->get_Visual_physical_store_ptr());
 		shared_ptr<Availability> p = Availability::create(physical_store, param_spec);
 		availabilities[p->get_property_name()] = p;
+		availability_cache.clear();
 		}
 	else {
 		Human_subprocessor::set_parameter(param_spec);
@@ -286,19 +293,18 @@ void Eye_processor::accept_event(const Visual_event * event_ptr)
 */
 
 // update the eccentricity and visibility of the supplied object using the visibility availability - dk 082909
-bool Eye_processor::update_eccentricity_and_visibility(shared_ptr<Visual_store_object> obj_ptr)
+bool Eye_processor::update_eccentricity_and_visibility(const shared_ptr<Visual_store_object>& obj_ptr)
 {
 	obj_ptr->update_eccentricity(eye_location);
 	// apply the availability function for visibility
-	// we should cache this function for efficiency
-	Availability_map_t::iterator it_availability = availabilities.find(Visible_c);
-	if(it_availability == availabilities.end()) {
-		throw Unknown_physical_property(this, Visible_c);
-		}
-	shared_ptr<Availability> a_ptr = it_availability->second;
+	Availability * a_ptr = get_availability(Visible_c);
 //	double x = eccentricity_fluctuation.get_double_value();
 	bool visible = a_ptr->available(obj_ptr);
 	obj_ptr->set_visible(visible);
+	if(visible)
+		visible_objects[obj_ptr->get_name()] = obj_ptr;
+	else
+		visible_objects.erase(obj_ptr->get_name());
 	return visible;
 }
 
@@ -309,6 +315,7 @@ void Eye_processor::make_object_appear(const Symbol& physical_name, GU::Point lo
 	Symbol psychological_name = get_psychological_name_and_new_status(physical_name, new_object);
 	// the physical name is now in use for an object that is present
 	name_map.set_physical_name_in_use(physical_name, true);
+	update_nearest_object(get_human_ptr()->get_Visual_physical_store_ptr()->get_object_ptr(physical_name));
 
 	if(get_trace() && Trace_out)
 		Trace_out << processor_info() << "make object " << physical_name << '/' << psychological_name 
@@ -394,6 +401,10 @@ const Symbol Offset_stationary_c ("Offset_stationary");
 // as this function returns.  If an eye movement is underway, set up to pass this event on when it is complete.
 void Eye_processor::make_object_disappear(const Symbol& physical_name)
 {
+	// the object will be gone from the physical store as soon as we return
+	visible_objects.erase(physical_name);
+	if(nearest_object_ptr && nearest_object_ptr->get_name() == physical_name)
+		invalidate_nearest_object();
 	// if the object went out of view a long time ago, it will be unknown to the system that it is disappearing, so do nothing
 	// if the object is not known.
 	if(!name_map.is_physical_name_present(physical_name)) {
@@ -469,6 +480,8 @@ void Eye_processor::set_object_location(const Symbol& physical_name, GU::Point l
 				<< " discarded because object no longer present" << endl;
 		return;
 		}
+	// the object has moved in the physical store whether or not the eye is in motion
+	update_nearest_object(get_human_ptr()->get_Visual_physical_store_ptr()->get_object_ptr(physical_name));
 
 	if(voluntary_saccade_underway || involuntary_saccade_underway) {
 		// queue a new event back to this Eye
@@ -642,16 +655,28 @@ void Eye_processor::set_object_property(const Symbol& physical_name, const Symbo
 		get_human_ptr()->get_visual_sensory_store_ptr(), name_map.get_psychological_name(physical_name), prop_name, new_value));
 }
 
-// returns true if property prop_name is available at this eccentricity for this object,
-// sets prop_value to new value if applicable
-bool Eye_processor::apply_availability(shared_ptr<Visual_store_object> obj_ptr, Symbol prop_name, Symbol& prop_value, long& delay)
+// return the availability for the property, looking it up in the cache first
+Availability * Eye_processor::get_availability(const Symbol& prop_name)
 {
-	// look up availability and delay functions in maps
+	for(Availability_cache_t::const_iterator it = availability_cache.begin(); it != availability_cache.end(); ++it) {
+		if(it->first == prop_name)
+			return it->second;
+		}
 	Availability_map_t::iterator it_availability = availabilities.find(prop_name);
 	if(it_availability == availabilities.end()) {
 		throw Unknown_physical_property(this, prop_name);
 		}
-	shared_ptr<Availability> a_ptr = it_availability->second;
+	Availability * a_ptr = it_availability->second.get();
+	availability_cache.push_back(make_pair(prop_name, a_ptr));
+	return a_ptr;
+}
+
+// returns true if property prop_name is available at this eccentricity for this object,
+// sets prop_value to new value if applicable
+bool Eye_processor::apply_availability(const shared_ptr<Visual_store_object>& obj_ptr, const Symbol& prop_name, Symbol& prop_value, long& delay)
+{
+	// look up availability and delay functions
+	Availability * a_ptr = get_availability(prop_name);
 	delay = 0; // initialize caller's delay
 //	double ecc = eccentricity_fluctuation.get_double_value(); // should delete this parameter 8/5/15
 	bool available = a_ptr->available(obj_ptr);
@@ -716,7 +741,7 @@ Symbol Eye_processor::get_psychological_name_and_new_status(Symbol physical_name
 
 // Update the object's location-based information, return true if object is currently visible or has gone out of view
 // meaning that its properties need checked for availability
-bool Eye_processor::update_location_information(shared_ptr<Visual_store_object> obj_ptr)
+bool Eye_processor::update_location_information(const shared_ptr<Visual_store_object>& obj_ptr)
 {
 	bool old_visibility = obj_ptr->is_visible();
 	// - dk 082909
@@ -777,7 +802,7 @@ void Eye_processor::send_eccentricity_update(const Symbol& psychological_name, d
 
 // Send the visual processor an update to all property values according to their visibility,
 // which has changed due to a change in location, size, or an eye movement.
-void Eye_processor::update_all_properties(shared_ptr<Visual_store_object> obj_ptr)
+void Eye_processor::update_all_properties(const shared_ptr<Visual_store_object>& obj_ptr)
 {
 	// access the object
 	Symbol_list_t prop_names;
@@ -796,7 +821,7 @@ Send the visual sensory store a message for every current property that says whe
 is present (the current value is sent) or absent(the default value is sent). 
 The visual sensory store will remove properties that are absent.
 */
-void Eye_processor::send_property_availability_update(shared_ptr<Visual_store_object> obj_ptr, 
+void Eye_processor::send_property_availability_update(const shared_ptr<Visual_store_object>& obj_ptr, 
 	const Symbol& prop_name, const Symbol& prop_value)
 {
 	// get the old availability
@@ -961,6 +986,8 @@ void Eye_processor::handle_event(const Eye_Involuntary_Smooth_Move_End_event *)
 
 void Eye_processor::update_objects_after_eye_movement()
 {
+	// the eye location has changed, so the nearest object must be found again
+	invalidate_nearest_object();
 	update_all_object_location_information();
 	update_closest_object();
 	update_all_object_properties();
@@ -969,13 +996,44 @@ void Eye_processor::update_objects_after_eye_movement()
 
 /* These functions are repetitious in the loop structure, but done that way for now for clarity */
 
-// This function updates the eccentricities of all objects and their other location parameters
+// ordering relation for putting objects in the same order as the store
+static bool name_less(const shared_ptr<Visual_store_object>& lhs, const shared_ptr<Visual_store_object>& rhs)
+{
+	return lhs->get_name() < rhs->get_name();
+}
+
+/* This function updates the eccentricities of all objects and their other location parameters.
+If visibility is limited to a radius, an object outside the radius that was not visible before
+is still not visible, and updating it would change only its eccentricity, which is not used
+for an invisible object. So only the objects within the radius (found with the spatial index),
+the currently visible objects, and objects whose names have been removed (which will get new
+names) are updated, in the same order as the store so that the events are scheduled in the same order.
+*/
 void Eye_processor::update_all_object_location_information()
 {
 	Visual_physical_store * visual_physical_store_ptr = get_human_ptr()->get_Visual_physical_store_ptr();
-	// scan all objects from a list of their ptr's
-	const Visual_store::Store_object_ptr_list_t& object_ptrs = visual_physical_store_ptr->get_object_ptr_list();
-	for(Visual_store::Store_object_ptr_list_t::const_iterator it = object_ptrs.begin(); it != object_ptrs.end(); ++it) {
+	double visible_radius = get_availability(Visible_c)->get_availability_radius();
+	if(visible_radius < 0.) {
+		// scan all objects
+		for(const shared_ptr<Visual_store_object>& obj_ptr : visual_physical_store_ptr->get_objects()) {
+			update_location_information(obj_ptr);
+			}
+		names_removed.clear();
+		return;
+		}
+	
+	Visual_spatial_index::Object_ptr_vector_t object_ptrs;
+	visual_physical_store_ptr->get_spatial_index().find_within(eye_location, visible_radius, object_ptrs);
+	for(auto it = visible_objects.begin(); it != visible_objects.end(); ++it)
+		object_ptrs.push_back(it->second);
+	for(auto it = names_removed.begin(); it != names_removed.end(); ++it) {
+		if(visual_physical_store_ptr->is_present(*it))
+			object_ptrs.push_back(visual_physical_store_ptr->get_object_ptr(*it));
+		}
+	names_removed.clear();
+	sort(object_ptrs.begin(), object_ptrs.end(), name_less);
+	object_ptrs.erase(unique(object_ptrs.begin(), object_ptrs.end()), object_ptrs.end());
+	for(auto it = object_ptrs.begin(); it != object_ptrs.end(); ++it) {
 		update_location_information(*it);
 		}
 }
@@ -983,34 +1041,54 @@ void Eye_processor::update_all_object_location_information()
 // This function updates the properties of all objects based on current eccentricity information
 void Eye_processor::update_all_object_properties()
 {
-	Visual_physical_store * visual_physical_store_ptr = get_human_ptr()->get_Visual_physical_store_ptr();
-	// scan all objects from a list of their ptr's
-	const Visual_store::Store_object_ptr_list_t& object_ptrs = visual_physical_store_ptr->get_object_ptr_list();
-	for(Visual_store::Store_object_ptr_list_t::const_iterator it = object_ptrs.begin(); it != object_ptrs.end(); ++it) {
-		// only do this if the object is visible - dk 082909
-		if((*it)->is_visible())
-			update_all_properties(*it);
+	// only do this if the object is visible - dk 082909
+	for(auto it = visible_objects.begin(); it != visible_objects.end(); ++it) {
+		update_all_properties(it->second);
 		}
 }
 
-// After an object has moved, check for the new closest object
+// After an object has moved, check for the new closest object;
+// the spatial index computes the distance the same way as the eccentricity,
+// and the previous closest object is kept if there are no objects
 void Eye_processor::update_closest_object()
 {
-	Visual_physical_store * visual_physical_store_ptr = get_human_ptr()->get_Visual_physical_store_ptr();
-	// scan all objects from a list of their ptr's
-	const Visual_store::Store_object_ptr_list_t& object_ptrs = visual_physical_store_ptr->get_object_ptr_list();
-	for(Visual_store::Store_object_ptr_list_t::const_iterator it = object_ptrs.begin(); it != object_ptrs.end(); ++it) {
-		shared_ptr<Visual_store_object> obj_ptr = *it;
-		double eccentricity = obj_ptr->get_eccentricity();
-		if(it == object_ptrs.begin()) {
-			closest_eccentricity = eccentricity;
-			closest_object_ptr = obj_ptr;
-			}
-		else if(eccentricity < closest_eccentricity) {
-			closest_eccentricity = eccentricity;
-			closest_object_ptr = obj_ptr;
-			}
+	if(!nearest_object_valid) {
+		Visual_physical_store * visual_physical_store_ptr = get_human_ptr()->get_Visual_physical_store_ptr();
+		nearest_object_ptr = visual_physical_store_ptr->get_spatial_index().find_nearest(eye_location, nearest_distance);
+		nearest_object_valid = bool(nearest_object_ptr);
 		}
+	if(nearest_object_ptr) {
+		closest_eccentricity = nearest_distance;
+		closest_object_ptr = nearest_object_ptr;
+		}
+}
+
+/* Update the nearest object for an object that has appeared or moved, without a search.
+If the nearest object has moved farther away, some other object might now be nearer,
+so the nearest object has to be found again. Ties are resolved by name, as in the spatial index,
+so the result is the same as if the nearest object had been found again. */
+void Eye_processor::update_nearest_object(const shared_ptr<Visual_store_object>& obj_ptr)
+{
+	if(!nearest_object_valid)
+		return;
+	double distance = cartesian_distance(obj_ptr->get_location(), eye_location);
+	if(obj_ptr == nearest_object_ptr) {
+		if(distance <= nearest_distance)
+			nearest_distance = distance;
+		else
+			invalidate_nearest_object();
+		}
+	else if(distance < nearest_distance || (distance == nearest_distance && obj_ptr->get_name() < nearest_object_ptr->get_name())) {
+		nearest_object_ptr = obj_ptr;
+		nearest_distance = distance;
+		}
+}
+
+void Eye_processor::invalidate_nearest_object()
+{
+	nearest_object_ptr.reset();
+	nearest_distance = 0.;
+	nearest_object_valid = false;
 }
 
 
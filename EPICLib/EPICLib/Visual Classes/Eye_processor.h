@@ -29,7 +29,9 @@ namespace GU = Geometry_Utilities;
 #include "Statistics.h"
 
 #include <map>
-//#include <set>
+#include <set>
+#include <vector>
+#include <utility>
 
 class Human_processor;
 class Symbol;
@@ -41,6 +43,7 @@ public:
 		Visual_store_processor ("Eye", human_ptr_), 
 		voluntary_saccade_underway(false), involuntary_saccade_underway(false), involuntary_smooth_move_underway(false), 
 		eye_movement_complete_time(0), closest_eccentricity(0.),
+		nearest_distance(0.), nearest_object_valid(false),
 		centering_enabled(false), centering_on(false), centering_active(false),
 		reflex_enabled(false), reflex_on(false),
 		auditory_reflex_enabled(false), auditory_reflex_on(false),
@@ -113,6 +116,9 @@ public:
 	// allow outsiders to access and modify the name map - e.g. to remove names
 	Name_map& get_name_map()
 		{return name_map;}
+	// whoever removes names from the name map must call this so the object gets a new name if still present
+	void note_names_removed(const Symbol& physical_name)
+		{names_removed.insert(physical_name);}
 		
 //	typedef bool (*Availability_function_t)(const Visual_physical_object&, double eccentricity_fluctuation);
 //	typedef long (*Delay_function_t)(const Visual_physical_object&, double time_fluctuation);
@@ -128,6 +134,15 @@ private:
 	long eye_movement_complete_time;
 	std::shared_ptr<Visual_store_object> closest_object_ptr;	// current object closest to point of fixation
 	double closest_eccentricity;
+	// the object nearest the eye location, maintained as objects appear, move, and disappear;
+	// it becomes invalid when the eye moves or the nearest object moves away or disappears,
+	// and is then found again with the spatial index the next time the closest object is updated
+	std::shared_ptr<Visual_store_object> nearest_object_ptr;
+	double nearest_distance;
+	bool nearest_object_valid;
+	// the currently visible physical objects, in the same name order as the store
+	std::map<Symbol, std::shared_ptr<Visual_store_object> > visible_objects;
+	std::set<Symbol> names_removed;	// physical names whose names were removed since the last eye movement
 	bool centering_enabled;
 	bool centering_on;
 	bool centering_active;
@@ -155,6 +170,11 @@ private:
 	typedef std::map<Symbol, std::shared_ptr<Availability> > Availability_map_t;
 	Availability_map_t availabilities;
 	std::shared_ptr<Availability> default_availability;
+	// the availabilities looked up so far, searched linearly because there are only a few properties
+	// and Symbol equality is much faster than the ordering comparison used by the map;
+	// must be cleared whenever availabilities is changed
+	typedef std::vector<std::pair<Symbol, Availability *> > Availability_cache_t;
+	Availability_cache_t availability_cache;
 	
 	// state
 	long psychobj_counter;	// counter for new object psychologial names
@@ -168,20 +188,23 @@ private:
 	Symbol get_psychological_name_and_new_status(Symbol physical_name, bool& new_object);
 //	void finish_make_object_appear(const Symbol& physical_name, GU::Point location, GU::Size size);
 	GU::Point location_noise(GU::Point location);
-	bool update_eccentricity_and_visibility(std::shared_ptr<Visual_store_object> obj_ptr);
-	bool update_location_information(std::shared_ptr<Visual_store_object> obj_ptr);
-	bool apply_availability(std::shared_ptr<Visual_store_object> obj_ptr, const Symbol prop_name, Symbol& prop_value, long& delay);
+	bool update_eccentricity_and_visibility(const std::shared_ptr<Visual_store_object>& obj_ptr);
+	bool update_location_information(const std::shared_ptr<Visual_store_object>& obj_ptr);
+	Availability * get_availability(const Symbol& prop_name);
+	bool apply_availability(const std::shared_ptr<Visual_store_object>& obj_ptr, const Symbol& prop_name, Symbol& prop_value, long& delay);
 	void send_eccentricity_update(const Symbol& psychological_name, double ecc);
-	void send_property_availability_update(std::shared_ptr<Visual_store_object> obj_ptr,
+	void send_property_availability_update(const std::shared_ptr<Visual_store_object>& obj_ptr,
 		const Symbol& prop_name, const Symbol& prop_value);
 	Symbol change_related_object_name(const Symbol& prop_name, const Symbol& prop_value);
 //	void send_property_change(const Visual_physical_object& obj, 
 //		const Symbol& prop_name, const Symbol& prop_value);
 	void update_all_object_location_information();
-	void update_all_properties(std::shared_ptr<Visual_store_object> obj_ptr);
+	void update_all_properties(const std::shared_ptr<Visual_store_object>& obj_ptr);
 	void update_all_object_properties();
 	void update_objects_after_eye_movement();	
 	void update_closest_object();
+	void update_nearest_object(const std::shared_ptr<Visual_store_object>& obj_ptr);
+	void invalidate_nearest_object();
 	void perform_centering();
 	bool free_to_move() const;
 
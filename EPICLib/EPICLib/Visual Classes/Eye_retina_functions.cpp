@@ -72,13 +72,13 @@ a property-specific "parafoveal" distance as modified by the fluctuation,
 and has a property-specific delay.
 */
 
-bool Zone_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Zone_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	return ( (eccentricity ) < zone_radius);
 }
 
-long Zone_availability::delay(shared_ptr<Visual_store_object>)
+long Zone_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return long(transduction_delay);
 }
@@ -136,7 +136,7 @@ Text_std_zone_availability::Text_std_zone_availability(const Visual_physical_sto
 probability regardless of where it is outside the fovea.
 if it is within the "standard" fovea, it is always available.
 */
-bool Flat_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Flat_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	return (
@@ -146,7 +146,7 @@ bool Flat_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
 		);
 }
 
-long Flat_availability::delay(shared_ptr<Visual_store_object>)
+long Flat_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -178,7 +178,7 @@ shared_ptr<Availability>Flat_availability::create(const Visual_physical_store& p
 probability if it has a certain value, and not otherwise, except 
 if it is within the "standard" fovea, it is always available.
 */
-bool Selector_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Selector_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	if(eccentricity <= standard_fovea_radius)
@@ -189,7 +189,7 @@ bool Selector_availability::available(shared_ptr<Visual_store_object> physobj_pt
 		return false;
 }
 
-long Selector_availability::delay(shared_ptr<Visual_store_object>)
+long Selector_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -223,7 +223,7 @@ shared_ptr<Availability>Selector_availability::create(const Visual_physical_stor
 /* Custom availability provides an arbitrary function for determining availability.
 This is intended as an aid to data fitting.
 */
-bool Custom_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Custom_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	
@@ -236,7 +236,7 @@ bool Custom_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
 		return (0.30 >= unit_uniform_random_variable());
 }
 
-long Custom_availability::delay(shared_ptr<Visual_store_object>)
+long Custom_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -270,7 +270,7 @@ shared_ptr<Availability>Custom_availability::create(const Visual_physical_store&
 /* Custom availability provides an arbitrary function for determining availability.
 This is intended as an aid to data fitting.
 */
-bool Custom_availability2::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Custom_availability2::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	
@@ -283,7 +283,7 @@ bool Custom_availability2::available(shared_ptr<Visual_store_object> physobj_ptr
 		return (0.20 >= unit_uniform_random_variable());
 }
 
-long Custom_availability2::delay(shared_ptr<Visual_store_object>)
+long Custom_availability2::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -324,7 +324,7 @@ The function specifies the minimum size for an object within the fovea,
 and the slope for the function. All units are in degrees VA.
 The delay is a flat value for the property.
 */
-bool Linear_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Linear_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -334,7 +334,7 @@ bool Linear_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
 	return (obj_size > threshold_size);
 }		
 
-long Linear_availability::delay(shared_ptr<Visual_store_object>)
+long Linear_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -375,7 +375,7 @@ The function specifies the minimum size for an object.
 All units are in degrees VA.
 The delay is a flat value for the property.
 */
-bool Fixed_quadratic_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Fixed_quadratic_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -384,7 +384,7 @@ bool Fixed_quadratic_availability::available(shared_ptr<Visual_store_object> phy
 	return (obj_size > threshold_size);
 }		
 
-long Fixed_quadratic_availability::delay(shared_ptr<Visual_store_object>)
+long Fixed_quadratic_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -432,7 +432,7 @@ or foveated object.
 All units are in degrees VA.
 The delay is a constant value for the property.
 */
-bool Quadratic_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Quadratic_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -447,7 +447,7 @@ bool Quadratic_availability::available(shared_ptr<Visual_store_object> physobj_p
 	return (obj_size + fluctuation > threshold_size);
 }		
 
-long Quadratic_availability::delay(shared_ptr<Visual_store_object>)
+long Quadratic_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -504,7 +504,7 @@ or
 P(detection) = lapsed_gaussian_detection_function(size, m, s, lapse_probability);
 */
 
-bool QuadraticConstSD::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool QuadraticConstSD::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -513,7 +513,7 @@ bool QuadraticConstSD::available(shared_ptr<Visual_store_object> physobj_ptr)
 	return lapsed_gaussian_detection_function(obj_size, mean, sd, lapse_prob);
 }
 
-long QuadraticConstSD::delay(shared_ptr<Visual_store_object>)
+long QuadraticConstSD::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -569,7 +569,7 @@ or
 P(detection) = lapsed_gaussian_detection_function(size, m, s, lapse_probability);
 */
 
-bool CubicConstSD::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool CubicConstSD::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -578,7 +578,7 @@ bool CubicConstSD::available(shared_ptr<Visual_store_object> physobj_ptr)
 	return lapsed_gaussian_detection_function(obj_size, mean, sd, lapse_prob);
 }
 
-long CubicConstSD::delay(shared_ptr<Visual_store_object>)
+long CubicConstSD::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -638,7 +638,7 @@ or
 P(detection) = lapsed_gaussian_detection_function(size, m, s, lapse_probability);
 */
 
-bool QuadraticLinearSD::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool QuadraticLinearSD::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -648,7 +648,7 @@ bool QuadraticLinearSD::available(shared_ptr<Visual_store_object> physobj_ptr)
 	return lapsed_gaussian_detection_function(obj_size, mean, s, lapse_prob);
 }
 
-long QuadraticLinearSD::delay(shared_ptr<Visual_store_object>)
+long QuadraticLinearSD::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -704,7 +704,7 @@ or
 P(detection) = lapsed_gaussian_detection_function(size, m, s, lapse_probability);
 */
 
-bool QuadraticCoefVarSD::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool QuadraticCoefVarSD::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -714,7 +714,7 @@ bool QuadraticCoefVarSD::available(shared_ptr<Visual_store_object> physobj_ptr)
 	return lapsed_gaussian_detection_function(obj_size, mean, s, lapse_prob);
 }
 
-long QuadraticCoefVarSD::delay(shared_ptr<Visual_store_object>)
+long QuadraticCoefVarSD::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -767,7 +767,7 @@ The function specifies the minimum size for an object.
 All units are in degrees VA.
 The delay is a flat value for the property.
 */
-bool Fixed_exponential_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Fixed_exponential_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -776,7 +776,7 @@ bool Fixed_exponential_availability::available(shared_ptr<Visual_store_object> p
 	return (obj_size > threshold_size);
 }		
 
-long Fixed_exponential_availability::delay(shared_ptr<Visual_store_object>)
+long Fixed_exponential_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -820,7 +820,7 @@ All units are in degrees VA.
 The delay is a flat value for the property.
 */
 
-bool Exponential_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Exponential_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// use the average of horizontal and vertical size
@@ -832,7 +832,7 @@ bool Exponential_availability::available(shared_ptr<Visual_store_object> physobj
 	return (obj_size + fluctuation > threshold_size);
 }		
 
-long Exponential_availability::delay(shared_ptr<Visual_store_object>)
+long Exponential_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -890,7 +890,7 @@ Color_quad_availability::Color_quad_availability(const Visual_physical_store& ph
 	Fixed_quadratic_availability(physical_store_, Color_c, delay_, .5, 0.02, 0.0001), red_min_size(1.5)
 {
 }
-bool Color_quad_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Color_quad_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	// the color is available generally, return true
 	if(Fixed_quadratic_availability::available(physobj_ptr))
@@ -951,7 +951,7 @@ Text_availability::Text_availability(const Visual_physical_store& physical_store
 {
 }
 
-bool Text_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
+bool Text_availability::available(const shared_ptr<Visual_store_object>& physobj_ptr)
 {
 	double eccentricity = physobj_ptr->get_eccentricity();
 	// threshold - if foveated it can be seen
@@ -968,7 +968,7 @@ bool Text_availability::available(shared_ptr<Visual_store_object> physobj_ptr)
 	return (obj_size > threshold_size);
 }		
 
-long Text_availability::delay(shared_ptr<Visual_store_object>)
+long Text_availability::delay(const shared_ptr<Visual_store_object>&)
 {
 	return transduction_delay;
 }
@@ -18,6 +18,8 @@ class Visual_physical_object;
 Base class for property availability objects.
 The available function returns true if the property is available.
 The delay function returns a time; it may be called even if the property is not available.
+The availability radius is the eccentricity at or beyond which the property is never available;
+it is negative if there is no such limit.
 */
 class Availability {
 public:
@@ -27,8 +29,10 @@ public:
 	const Symbol& get_property_name() const 
 		{return property_name;}
 		
-	virtual bool available(std::shared_ptr<Visual_store_object> physobj_ptr) = 0;
-	virtual long delay(std::shared_ptr<Visual_store_object> physobj_ptr) = 0;
+	virtual bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) = 0;
+	virtual long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) = 0;
+	virtual double get_availability_radius() const
+		{return -1.;}
 	virtual std::string get_description() const = 0;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store, const Parameter_specification& param_spec);
 
@@ -50,8 +54,10 @@ public:
 		long delay_, double zone_radius_) :
 		Availability(physical_store_, property_name_), transduction_delay(delay_), zone_radius(zone_radius_)
 		{}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	double get_availability_radius() const override
+		{return zone_radius;}
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -121,8 +127,8 @@ public:
 		long delay_, double probability_) :
 		Availability(physical_store_, property_name_), transduction_delay(delay_), probability(probability_)
 		{}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -142,8 +148,8 @@ public:
 		long delay_, Symbol selected_value_, double probability_) :
 		Availability(physical_store_, property_name_), transduction_delay(delay_), selected_value(selected_value_), probability(probability_)
 		{}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -162,8 +168,8 @@ public:
 		long delay_) :
 		Availability(physical_store_, property_name_), transduction_delay(delay_)
 		{}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -177,8 +183,8 @@ public:
 		long delay_) :
 		Availability(physical_store_, property_name_), transduction_delay(delay_)
 		{}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -201,8 +207,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_), 
 		min_size(min_size_),slope(slope_)
 		{Assert(min_size > 0. && slope > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -227,8 +233,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_), 
 		intercept(intercept_),x_coeff(x_coeff_), x2_coeff(x2_coeff_)
 		{Assert(intercept_ > 0. && x_coeff > 0. && x2_coeff > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -255,8 +261,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_), zone(zone_), coefvar(coefvar_),
 		intercept(intercept_),x_coeff(x_coeff_), x2_coeff(x2_coeff_)
 		{Assert(coefvar > 0. && intercept_ >= 0. && x_coeff >= 0. && x2_coeff >= 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -288,8 +294,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_),
 		lapse_prob(lapse_prob_), a(a_), b(b_), c(c_), sd(sd_)
 		{Assert(lapse_prob >= 0. && a >= 0. && b >= 0. && c >= 0. && sd > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -321,8 +327,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_),
 		lapse_prob(lapse_prob_), a(a_), b(b_), c(c_), d(d_), sd(sd_)
 		{Assert(lapse_prob >= 0. && a >= 0. && b >= 0. && c >= 0. && d >= 0. && sd > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -357,8 +363,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_),
 		lapse_prob(lapse_prob_), a(a_), b(b_), c(c_), noise_coeff(noise_coeff_)
 		{Assert(lapse_prob >= 0. && a >= 0. && b >= 0. && c >= 0. && noise_coeff > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -390,8 +396,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_),
 		lapse_prob(lapse_prob_), a(a_), b(b_), c(c_), coef_var(coef_var_)
 		{Assert(lapse_prob >= 0. && a >= 0. && b >= 0. && c >= 0. && coef_var > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -422,8 +428,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_), 
 		coeff(coeff_), expon(expon_)
 		{Assert(coeff > 0. && expon > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_, 
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -449,8 +455,8 @@ public:
 		Availability(physical_store_, property_name_), transduction_delay(delay_), 
 		coefvar(coefvar_), coeff(coeff_), expon(expon_)
 		{Assert(coefvar > 0. && coeff > 0. && expon > 0.);}
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 	static std::shared_ptr<Availability> create(const Visual_physical_store& physical_store_, const Symbol& property_name_,
 		const Parameter_specification& param_spec, std::istringstream& iss);
@@ -484,7 +490,7 @@ The delay is a flat value for the property.
 class Color_quad_availability : public Fixed_quadratic_availability {
 public:
 	Color_quad_availability(const Visual_physical_store& physical_store_, long delay_ = standard_delay);
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 private:
 	double red_min_size;
 };
@@ -509,8 +515,8 @@ public:
 class Text_availability : public Availability {
 public:
 	Text_availability(const Visual_physical_store& physical_store_, long delay_ = standard_delay);
-	bool available(std::shared_ptr<Visual_store_object> physobj_ptr) override;
-	long delay(std::shared_ptr<Visual_store_object> physobj_ptr) override;
+	bool available(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
+	long delay(const std::shared_ptr<Visual_store_object>& physobj_ptr) override;
 	std::string get_description() const override;
 private:
 	long transduction_delay;
@@ -73,6 +73,9 @@ void Visual_Erase_Property_event::handle_self(Visual_sensory_store * proc_ptr) c
 void Visual_Erase_Property_event::handle_self(Visual_perceptual_store * proc_ptr) const
 	{proc_ptr->handle_event(this);}
 
+void Visual_Decay_event::handle_self(Visual_perceptual_store * proc_ptr) const
+	{proc_ptr->handle_event(this);}
+
 //void Visual_Delay_event::handle_self(Eye_processor * proc_ptr) const
 //	{proc_ptr->handle_event(this);}
 // void Visual_Delay_event::handle_self(Visual_sensory_store * proc_ptr) const
@@ -101,6 +101,16 @@ public:
 	Symbol property_value;
 };
 
+// the Visual_perceptual_store sends itself one of these for each time at which
+// objects or properties are scheduled to decay; the store keeps the list of what decays
+class Visual_Decay_event : public Visual_event {
+public:
+	Visual_Decay_event(long t, Processor * r) : 
+		Visual_event(t, r)
+		{}
+	virtual void handle_self(Visual_perceptual_store *) const;
+};
+
 class Visual_Delay_event : public Visual_event {
 public:
 	Visual_Delay_event(
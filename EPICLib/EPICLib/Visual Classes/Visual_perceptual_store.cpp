@@ -15,11 +15,13 @@
 #include <map>
 #include <typeinfo>
 #include <memory>
+#include <vector>
 	
 using std::cout;	using std::endl;
 using std::string;
 using std::list;
 using std::map;
+using std::vector;
 using std::shared_ptr; using std::make_shared;
 /*
 2/19/09
@@ -49,15 +51,15 @@ Specifics:
 
 If an object disappears: 
 	set state to UNSUPPORTED
-	schedule a first Erase event to arrive after unsupported_object_decay_time, and set the disappearance time to this time also
-If an object erase event arrives:
+	schedule a first erasure to happen after unsupported_object_decay_time, and set the disappearance time to this time also
+If an object erasure comes due:
 	If the object is not present - ignore with a trace message
 	If the disappearance time is 0 (cancelled) or > current_time, ignore this erase event - do nothing (no message)
 	Do one of the following depending on the state of the object:
 	The object is UNSUPPORTED:
 		set the Status to Disappearing and inform cogp and the views
 		set the state to RETAINED
-		schedule a second Erase event to arrive after retained_object_decay_time, and set the disappearance time to this time
+		schedule a second erasure to happen after retained_object_decay_time, and set the disappearance time to this time
 		do nothing more
 	The object is REATAINED:
 		remove it from the store and inform cogp and the views and remove it from the name map!
@@ -66,13 +68,19 @@ If an object erase event arrives:
 
 Properties of an object are retained, removed, and reinstated as follows:
 When a Change Property event arrives:
-	If the property is to be removed, we save the disappearing time, and send an erase event for that time.
+	If the property is to be removed, we save the disappearing time, and schedule a property erasure for that time.
 	If a property is being set (as opposed to removed), any disappearing time is removed.
 
-When an Erase Property event arrives, if the object is still present, we aacess the disappearing time and then decide:
+When a property erasure comes due, if the object is still present, we aacess the disappearing time and then decide:
 	if 0, was canceled, ignore (no message)
-	if > current time, was reinstated, and then lost again, so ignore (no message), let later erase event come.
+	if > current time, was reinstated, and then lost again, so ignore (no message), let later erasure come.
 	if == current time, remove it now with message. (along with disappearing time)
+
+Object and property erasures are not scheduled as individual events. Instead, they are filed in the
+decay schedule under the time they are due, and a single Visual_Decay_event is scheduled for each time.
+When it arrives, the erasures due at that time are done in the order they were scheduled.
+Models with many transient objects would otherwise put an event in the queue for every property
+of every disappearing object.
 */
 
 
@@ -123,6 +131,12 @@ shared_ptr<Visual_perceptual_object> Visual_perceptual_store::get_perceptual_obj
 
 /*** Visual_perceptual_store ***/
 
+void Visual_perceptual_store::initialize()
+{
+	Visual_store::initialize();
+	decay_schedule.clear();
+}
+
 // these functions use the base class then construct an update for the cognitive processor, that needs
 // old and new values for updating.
 void Visual_perceptual_store::accept_event(const Visual_event * event_ptr)
@@ -213,7 +227,7 @@ void Visual_perceptual_store::handle_event(const Visual_Disappear_event * event_
 	// schedule an erasure event for later,  note the time
 	long first_erase_time = get_time() + unsupported_object_decay_time.get_long_value();
 	obj_ptr->set_disappearing_time(first_erase_time);
-	schedule_event(new Visual_Erase_event(first_erase_time, this, event_ptr->object_name));
+	schedule_decay(first_erase_time, event_ptr->object_name);
 	
 	// that's all for now
 
@@ -252,24 +266,56 @@ void Visual_perceptual_store::handle_event(const Visual_Disappear_event * event_
 //	erase(event_ptr->object_name);
 }
 
+// file the decay under its time, and schedule the event for that time if it is the first one
+void Visual_perceptual_store::schedule_decay(long decay_time, const Symbol& object_name,
+	const Symbol& property_name, const Symbol& property_value)
+{
+	vector<Decay>& decays = decay_schedule[decay_time];
+	if(decays.empty())
+		schedule_event(new Visual_Decay_event(decay_time, this));
+	Decay decay = {object_name, property_name, property_value};
+	decays.push_back(decay);
+}
+
+void Visual_perceptual_store::handle_event(const Visual_Decay_event *)
+{
+	Decay_schedule_t::iterator it = decay_schedule.find(get_time());
+	Assert(it != decay_schedule.end());
+	// take the decays out of the schedule first, in case processing them schedules more for this time
+	vector<Decay> decays;
+	decays.swap(it->second);
+	decay_schedule.erase(it);
+	for(vector<Decay>::const_iterator it_decay = decays.begin(); it_decay != decays.end(); ++it_decay) {
+		if(it_decay->property_name == Nil_c)
+			decay_object(it_decay->object_name);
+		else
+			decay_property(it_decay->object_name, it_decay->property_name, it_decay->property_value);
+		}
+}
+
 void Visual_perceptual_store::handle_event(const Visual_Erase_event * event_ptr)
+{
+	decay_object(event_ptr->object_name);
+}
+
+void Visual_perceptual_store::decay_object(const Symbol& object_name)
 {
 	// check to see if the object is still present - it might have already disappeared
-	if(!is_present(event_ptr->object_name)) {
+	if(!is_present(object_name)) {
 		if(get_trace() && Trace_out)
-			Trace_out << processor_info() << event_ptr->object_name 
+			Trace_out << processor_info() << object_name 
 				<< " no longer present for erasure" << endl;
 		return;
 		}
 	
-	shared_ptr<Visual_perceptual_object> obj_ptr = get_perceptual_object_ptr(event_ptr->object_name);
+	shared_ptr<Visual_perceptual_object> obj_ptr = get_perceptual_object_ptr(object_name);
 	Assert(obj_ptr);	// only if gross programming error
 	// check the disappearing time
 	long disappearing_time = obj_ptr->get_disappearing_time();
 	// if canceled, or comes later than current time, do nothing with this event
 	if(disappearing_time == 0 || disappearing_time > get_time()) {
 		if(get_trace() && Trace_out)
-			Trace_out << processor_info() << event_ptr->object_name 
+			Trace_out << processor_info() << object_name 
 				<< " erase event discarded or superseded" << endl;
 		return;
 		}
@@ -279,12 +325,12 @@ void Visual_perceptual_store::handle_event(const Visual_Erase_event * event_ptr)
 	switch(obj_ptr->get_state()) {
 		case Visual_perceptual_object::UNSUPPORTED: {
 			if(get_trace() && Trace_out)
-				Trace_out << processor_info() << event_ptr->object_name  << " disappearing but being retained in memory" << endl;
+				Trace_out << processor_info() << object_name  << " disappearing but being retained in memory" << endl;
 
-			Visual_store::make_object_disappear(event_ptr->object_name);
+			Visual_store::make_object_disappear(object_name);
 
 			// immediately tell cogp that the object is disappearing
-			update_property(event_ptr->object_name, Status_c, Disappearing_c);
+			update_property(object_name, Status_c, Disappearing_c);
 			// Put the object into the "Retained" state to show that it is now in the special visual memory state
 			obj_ptr->set_state(Visual_perceptual_object::RETAINED);
 
@@ -303,10 +349,10 @@ void Visual_perceptual_store::handle_event(const Visual_Erase_event * event_ptr)
 			*/
 			
 			// 1/20/03 this gives independent object loss
-			// schedule an erasure event for later
+			// schedule an erasure for later
 			long second_erase_time = get_time() + retained_object_decay_time.get_long_value();
 			obj_ptr->set_disappearing_time(second_erase_time);
-			schedule_event(new Visual_Erase_event(second_erase_time, this, event_ptr->object_name));
+			schedule_decay(second_erase_time, object_name);
 			break;
 			}
 		
@@ -318,7 +364,7 @@ void Visual_perceptual_store::handle_event(const Visual_Erase_event * event_ptr)
 		
 		case Visual_perceptual_object::PRESENT: {
 			if(get_trace() && Trace_out)
-				Trace_out << processor_info() << event_ptr->object_name  << " was disappearing but got reinstated" << endl;
+				Trace_out << processor_info() << object_name  << " was disappearing but got reinstated" << endl;
 			break;
 			}
 		
@@ -382,11 +428,13 @@ void Visual_perceptual_store::lose_object_from_memory(shared_ptr<Visual_perceptu
 	// Thus we only remove the names if the physical name is not in use (e.g. for a just appeared object) - dk 3/11/09
 	// A problem might still appear if the name is referred to on this same cycle for an aimed movement.
 	Name_map& name_map = get_human_ptr()->get_Eye_processor_ptr()->get_name_map();
-	const Symbol& physical_name = name_map.get_physical_name(object_name);
+	// a copy, because the name is about to be removed from the map
+	const Symbol physical_name = name_map.get_physical_name(object_name);
 	if(!(name_map.is_physical_name_in_use(physical_name))) {
 		if(get_trace() && Trace_out)
 			Trace_out << processor_info() <<  "Object names " << physical_name << '/' << object_name << " removed from Visual system" << endl;
 		name_map.remove_names_with_psychological_name(object_name);
+		get_human_ptr()->get_Eye_processor_ptr()->note_names_removed(physical_name);
 		}
 	else {
 		if(get_trace() && Trace_out)
@@ -445,9 +493,9 @@ void Visual_perceptual_store::handle_event(const Visual_Change_Location_event *
 			update_object_property(Visual_c, event_ptr->object_name, Location_c, Nil_c, Change_c);
 
 		// schedule for later delivery
-		schedule_event(new Cognitive_Update_event(
-			get_time() + change_decay_time.get_long_value(), get_human_ptr()->get_Cognitive_processor_ptr(),
-			Visual_c, event_ptr->object_name, Location_c, Change_c, Nil_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time() + change_decay_time.get_long_value(),
+			Visual_c, event_ptr->object_name, Location_c, Change_c, Nil_c);
 		}
 }
 
@@ -460,9 +508,9 @@ void Visual_perceptual_store::handle_event(const Visual_Change_Size_event * even
 			update_object_property(Visual_c, event_ptr->object_name, Size_c, Nil_c, Change_c);
 
 		// schedule for later delivery
-		schedule_event(new Cognitive_Update_event(
-			get_time() + change_decay_time.get_long_value(), get_human_ptr()->get_Cognitive_processor_ptr(),
-			Visual_c, event_ptr->object_name, Size_c, Change_c, Nil_c));
+		get_human_ptr()->get_Cognitive_processor_ptr()->schedule_object_property_update(
+			get_time() + change_decay_time.get_long_value(),
+			Visual_c, event_ptr->object_name, Size_c, Change_c, Nil_c);
 		}
 }
 
@@ -518,9 +566,8 @@ void Visual_perceptual_store::handle_event(const Visual_Change_Property_event *
 		long disappearing_time = get_time() + property_decay_time.get_long_value();
 		// save the disappearance time for this property
 		obj_ptr->set_disappearing_time(event_ptr->property_name, disappearing_time);
-		// schedule a property erasure event for later - send old value along for comparison to current value
-		schedule_event(new Visual_Erase_Property_event( disappearing_time, this,
-			event_ptr->object_name, event_ptr->property_name, old_value));
+		// schedule a property erasure for later - save old value along for comparison to current value
+		schedule_decay(disappearing_time, event_ptr->object_name, event_ptr->property_name, old_value);
 		return;	// do nothing further
 		}
 		
@@ -550,20 +597,25 @@ void Visual_perceptual_store::update_property(const Symbol& object_name, const S
 
 
 void Visual_perceptual_store::handle_event(const Visual_Erase_Property_event * event_ptr)
+{
+	decay_property(event_ptr->object_name, event_ptr->property_name, event_ptr->property_value);
+}
+
+void Visual_perceptual_store::decay_property(const Symbol& object_name, const Symbol& property_name, const Symbol& property_value)
 {
 	// here because the property value is being erased
 	// do nothing if the object is not present - not very efficient, but erasure of whole object may have already happened
-	if(!is_present(event_ptr->object_name)) {
+	if(!is_present(object_name)) {
 		if(get_trace() && Trace_out)
-			Trace_out << processor_info() << event_ptr->object_name 
-				<< " no longer present for erasure of " << event_ptr->property_name << endl;
+			Trace_out << processor_info() << object_name 
+				<< " no longer present for erasure of " << property_name << endl;
 		return;
 		}
 	// access the disappearing_property record
-	shared_ptr<Visual_store_object> obj_ptr = get_object_ptr(event_ptr->object_name);
-	Symbol current_value = obj_ptr->get_property_value(event_ptr->property_name);
+	shared_ptr<Visual_store_object> obj_ptr = get_object_ptr(object_name);
+	Symbol current_value = obj_ptr->get_property_value(property_name);
 	// this returns 0 if the disappearance record for this property does not exist
-	long disappearing_time = obj_ptr->get_disappearing_time(event_ptr->property_name);
+	long disappearing_time = obj_ptr->get_disappearing_time(property_name);
 	// do nothing further if the disappearance record does not exist - it was conceled.
 	if(disappearing_time == 0)
 		return;
@@ -575,13 +627,13 @@ void Visual_perceptual_store::handle_event(const Visual_Erase_Property_event * e
 	
 	// The disappearance time should match the current time, and the value in the event must match the current state;
 	// if so, do the erasure and removal from the cognitive processor store
-	else if (get_time() == disappearing_time && current_value == event_ptr->property_value) {
+	else if (get_time() == disappearing_time && current_value == property_value) {
 		if(get_trace() && Trace_out)
-			Trace_out << processor_info() << event_ptr->object_name << " losing property " << event_ptr->property_name << endl;
+			Trace_out << processor_info() << object_name << " losing property " << property_name << endl;
 		// remove the property disappearance record
-		obj_ptr->remove_disappearing_time(event_ptr->property_name);
+		obj_ptr->remove_disappearing_time(property_name);
 		// update the store and broadcast the change
-		update_property(event_ptr->object_name, event_ptr->property_name, Nil_c);
+		update_property(object_name, property_name, Nil_c);
 /*		// update the store and broadcast the change
 		Symbol old_value = Visual_store::set_object_property(event_ptr->object_name, event_ptr->property_name, Nil_c);
 		// send through to cognitive processor immediately
@@ -591,7 +643,7 @@ void Visual_perceptual_store::handle_event(const Visual_Erase_Property_event * e
 */
 		}
 	else
-		throw Epic_internal_error(this, string("Unexpected Visual_Erase_Property_event for ") +
-			event_ptr->object_name.str() + " property " + event_ptr->property_name.str());
+		throw Epic_internal_error(this, string("Unexpected property erasure for ") +
+			object_name.str() + " property " + property_name.str());
 }
 
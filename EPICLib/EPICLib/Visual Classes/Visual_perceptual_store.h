@@ -8,6 +8,7 @@
 namespace GU = Geometry_Utilities;
 
 #include <map>
+#include <vector>
 
 
 /* Visual_perceptual_store contains Perceptual objects with additional recoded properties.
@@ -89,7 +90,7 @@ public:
 			add_parameter(property_decay_time);
 		}
 
-//	virtual void initialize()
+	virtual void initialize();
 
 	// event interface
 //	virtual void accept_event(const Start_event *);
@@ -104,6 +105,7 @@ public:
 	virtual void handle_event(const Visual_Change_Size_event *);
 	virtual void handle_event(const Visual_Change_Property_event *);
 	virtual void handle_event(const Visual_Erase_Property_event *);
+	virtual void handle_event(const Visual_Decay_event *);
 	
 	std::shared_ptr<Visual_perceptual_object> get_perceptual_object_ptr(const Symbol& name);
 
@@ -121,6 +123,21 @@ private:
 	Parameter retained_object_decay_time;
 	Parameter property_decay_time;
 
+	// The scheduled decays of objects and properties, in the order they were scheduled,
+	// filed under the time they are due. A single Visual_Decay_event is scheduled for each time,
+	// and it processes all of the decays due at that time.
+	struct Decay {
+		Symbol object_name;
+		Symbol property_name;	// Nil_c if the whole object is decaying
+		Symbol property_value;	// the value being lost, for comparison with the current value
+	};
+	typedef std::map<long, std::vector<Decay> > Decay_schedule_t;
+	Decay_schedule_t decay_schedule;
+
+	void schedule_decay(long decay_time, const Symbol& object_name,
+		const Symbol& property_name = Symbol(), const Symbol& property_value = Symbol());
+	void decay_object(const Symbol& object_name);
+	void decay_property(const Symbol& object_name, const Symbol& property_name, const Symbol& property_value);
 	void lose_object_from_memory(std::shared_ptr<Visual_perceptual_object> obj_ptr);
 //	bool update_retained_objects();
 	void update_property(const Symbol& object_name, const Symbol& property_name, const Symbol& new_value);
@@ -16,6 +16,7 @@ using std::cout;	using std::endl;
 using std::string;
 using std::ostringstream;
 using std::list;
+using std::shared_ptr;
 
 
 /* Exception classes */
@@ -106,6 +107,7 @@ void Visual_physical_object::display_contents(Output_tee& ot) const
 void Visual_physical_store::initialize()
 {
 	Visual_store::initialize();
+	spatial_index.clear();
 	//Assert(vsensory_ptr);
 //	psychobj_counter = 0;
 //	set_randomize_when_used(true);
@@ -139,7 +141,9 @@ void Visual_physical_store::make_object_appear(const Symbol& physical_name, GU::
 	if(is_present(physical_name))
 		throw Create_duplicate_physical_store_object(this, physical_name);
 		
-	insert_new(Visual_physical_object::create(physical_name, location, size));
+	shared_ptr<Visual_store_object> obj_ptr = Visual_physical_object::create(physical_name, location, size);
+	insert_new(obj_ptr);
+	spatial_index.insert(obj_ptr);
 	
 	if(get_trace() && Trace_out) {
 		Trace_out << processor_info() << "new object: " << physical_name << endl;
@@ -161,14 +165,17 @@ void Visual_physical_store::make_object_disappear(const Symbol& physical_name)
 	// call downstream to let the processor know 
 	get_human_ptr()->get_Eye_processor_ptr()->make_object_disappear(physical_name);
 	// now that eye processor has had a chance to see it, remove the object
+	spatial_index.remove(get_object_ptr(physical_name));
 	Visual_store::erase_object(physical_name);
 }
 
 GU::Point Visual_physical_store::set_object_location(const Symbol& physical_name, GU::Point location)
 {
 	GU::Point old_value = Visual_store::set_object_location(physical_name, location);
-	if(changed)
+	if(changed) {
+		spatial_index.move(get_object_ptr(physical_name), old_value);
 		get_human_ptr()->get_Eye_processor_ptr()->set_object_location(physical_name, location);
+		}
 	return old_value;
 }
 
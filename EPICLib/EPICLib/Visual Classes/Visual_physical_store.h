@@ -17,6 +17,7 @@ direct call of the Eye_processor to act on that change.
 
 
 #include "Visual_store.h"
+#include "Visual_spatial_index.h"
 #include "Symbol.h"
 #include "OPV_Containers.h"
 #include "Geometry.h"
@@ -85,7 +86,13 @@ public:
 	virtual GU::Size set_object_size(const Symbol& obj_name, GU::Size size);
 	virtual Symbol set_object_property(const Symbol& obj_name, const Symbol& propname, const Symbol& propvalue);
 
+	// the spatial index over the current object locations
+	const Visual_spatial_index& get_spatial_index() const
+		{return spatial_index;}
+
 private:
+	Visual_spatial_index spatial_index;
+
 	// no copy, assignment
 	Visual_physical_store(const Visual_physical_store&);
 	Visual_physical_store& operator= (const Visual_physical_store&);
@@ -0,0 +1,136 @@
+#include "Visual_spatial_index.h"
+#include "Visual_store.h"
+#include "Assert_throw.h"
+
+#include <cmath>
+
+using std::vector;
+using std::shared_ptr;
+using std::floor;
+
+void Visual_spatial_index::clear()
+{
+	cells.clear();
+	n_objects = 0;
+}
+
+void Visual_spatial_index::insert(shared_ptr<Visual_store_object> obj_ptr)
+{
+	cells[get_cell(obj_ptr->get_location())].push_back(obj_ptr);
+	n_objects++;
+}
+
+void Visual_spatial_index::remove(shared_ptr<Visual_store_object> obj_ptr)
+{
+	remove_from_cell(get_cell(obj_ptr->get_location()), obj_ptr.get());
+	n_objects--;
+}
+
+void Visual_spatial_index::move(shared_ptr<Visual_store_object> obj_ptr, GU::Point old_location)
+{
+	Cell_t old_cell = get_cell(old_location);
+	Cell_t new_cell = get_cell(obj_ptr->get_location());
+	if(new_cell == old_cell)
+		return;
+	remove_from_cell(old_cell, obj_ptr.get());
+	cells[new_cell].push_back(obj_ptr);
+}
+
+Visual_spatial_index::Cell_t Visual_spatial_index::get_cell(GU::Point p) const
+{
+	return Cell_t(long(floor(p.x / cell_size)), long(floor(p.y / cell_size)));
+}
+
+void Visual_spatial_index::remove_from_cell(const Cell_t& cell, const Visual_store_object * obj_ptr)
+{
+	Cell_container_t::iterator it = cells.find(cell);
+	Assert(it != cells.end());
+	Object_ptr_vector_t& objects = it->second;
+	for(Object_ptr_vector_t::iterator it_obj = objects.begin(); it_obj != objects.end(); ++it_obj) {
+		if(it_obj->get() == obj_ptr) {
+			// order within a cell does not matter, so fill the hole with the last one
+			*it_obj = objects.back();
+			objects.pop_back();
+			if(objects.empty())
+				cells.erase(it);
+			return;
+			}
+		}
+	Assert(!"object to be removed not found in Visual_spatial_index");
+}
+
+// the range of cells is widened by one in each direction so that rounding in get_cell
+// cannot exclude an object that is within the radius
+void Visual_spatial_index::find_within(GU::Point center, double radius, Object_ptr_vector_t& results) const
+{
+	Cell_t low = get_cell(GU::Point(center.x - radius, center.y - radius));
+	Cell_t high = get_cell(GU::Point(center.x + radius, center.y + radius));
+	Cell_container_t::const_iterator it = cells.lower_bound(Cell_t(low.first - 1, low.second - 1));
+	Cell_container_t::const_iterator it_end = cells.upper_bound(Cell_t(high.first + 1, high.second + 1));
+	for(; it != it_end; ++it) {
+		long row = it->first.second;
+		if(row < low.second - 1 || row > high.second + 1)
+			continue;
+		const Object_ptr_vector_t& objects = it->second;
+		for(Object_ptr_vector_t::const_iterator it_obj = objects.begin(); it_obj != objects.end(); ++it_obj) {
+			if(cartesian_distance((*it_obj)->get_location(), center) < radius)
+				results.push_back(*it_obj);
+			}
+		}
+}
+
+/*
+Examine the rings of cells around the cell containing the point, starting with that cell.
+Every object in a cell outside ring n is at least n * cell_size from the point;
+allowing a cell's worth of slack for rounding, the search stops once ring n has been
+examined and the best distance so far is less than (n - 1) * cell_size.
+If the rings have grown to cover more cells than are occupied, it is cheaper to simply
+check every occupied cell.
+*/
+shared_ptr<Visual_store_object> Visual_spatial_index::find_nearest(GU::Point point, double& distance) const
+{
+	shared_ptr<Visual_store_object> best_ptr;
+	double best_distance = 0.;
+	Cell_t home = get_cell(point);
+	for(long ring = 0; ; ring++) {
+		if(best_ptr && best_distance < (ring - 2) * cell_size)
+			break;
+		if((2 * ring + 1) * (2 * ring + 1) > long(cells.size())) {
+			for(Cell_container_t::const_iterator it = cells.begin(); it != cells.end(); ++it)
+				check_nearest(it->second, point, best_ptr, best_distance);
+			break;
+			}
+		// the first and last columns of the ring are taken whole
+		long first_column = home.first - ring;
+		long last_column = home.first + ring;
+		for(long column = first_column; column <= last_column; column += (ring > 0) ? 2 * ring : 1) {
+			Cell_container_t::const_iterator it = cells.lower_bound(Cell_t(column, home.second - ring));
+			Cell_container_t::const_iterator it_end = cells.upper_bound(Cell_t(column, home.second + ring));
+			for(; it != it_end; ++it)
+				check_nearest(it->second, point, best_ptr, best_distance);
+			}
+		// the columns in between contribute only their top and bottom cells
+		for(long column = first_column + 1; column < last_column; column++) {
+			Cell_container_t::const_iterator it = cells.find(Cell_t(column, home.second - ring));
+			if(it != cells.end())
+				check_nearest(it->second, point, best_ptr, best_distance);
+			it = cells.find(Cell_t(column, home.second + ring));
+			if(it != cells.end())
+				check_nearest(it->second, point, best_ptr, best_distance);
+			}
+		}
+	distance = best_distance;
+	return best_ptr;
+}
+
+void Visual_spatial_index::check_nearest(const Object_ptr_vector_t& objects, GU::Point point,
+	shared_ptr<Visual_store_object>& best_ptr, double& best_distance) const
+{
+	for(Object_ptr_vector_t::const_iterator it = objects.begin(); it != objects.end(); ++it) {
+		double d = cartesian_distance((*it)->get_location(), point);
+		if(!best_ptr || d < best_distance || (d == best_distance && (*it)->get_name() < best_ptr->get_name())) {
+			best_ptr = *it;
+			best_distance = d;
+			}
+		}
+}
@@ -0,0 +1,67 @@
+#ifndef VISUAL_SPATIAL_INDEX_H
+#define VISUAL_SPATIAL_INDEX_H
+
+/*
+Visual_spatial_index is a uniform grid over the locations of Visual_store_objects.
+Each object is filed under the square cell that contains its location, so that
+the objects near a point can be found without scanning the whole store.
+
+The owner of the index must keep it consistent with the store: insert an object when
+it appears, call move with the old location before or after the object's location
+is changed, and remove it when it disappears.
+
+Distances are between object locations (centers), computed with cartesian_distance,
+so the results agree exactly with the eccentricities computed by the Eye_processor.
+Where several objects are equally close, the one with the lowest name is chosen,
+which is the one first encountered in the name order of the store.
+*/
+
+#include "Geometry.h"
+namespace GU = Geometry_Utilities;
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <memory>
+
+class Visual_store_object;
+
+class Visual_spatial_index {
+public:
+	typedef std::vector<std::shared_ptr<Visual_store_object> > Object_ptr_vector_t;
+
+	Visual_spatial_index(double cell_size_ = 5.0) :
+		cell_size(cell_size_), n_objects(0)
+		{}
+
+	void clear();
+	void insert(std::shared_ptr<Visual_store_object> obj_ptr);
+	// remove the object, which must be at the location it was inserted or last moved to
+	void remove(std::shared_ptr<Visual_store_object> obj_ptr);
+	// refile the object, whose location used to be old_location
+	void move(std::shared_ptr<Visual_store_object> obj_ptr, GU::Point old_location);
+
+	int size() const
+		{return n_objects;}
+
+	// append to results the objects whose distance from center is less than radius, in no particular order
+	void find_within(GU::Point center, double radius, Object_ptr_vector_t& results) const;
+	// return the object closest to the point and set distance to its distance;
+	// return a null pointer if there are no objects
+	std::shared_ptr<Visual_store_object> find_nearest(GU::Point point, double& distance) const;
+
+private:
+	typedef std::pair<long, long> Cell_t;	// column, row
+	typedef std::map<Cell_t, Object_ptr_vector_t> Cell_container_t;
+	double cell_size;
+	int n_objects;
+	Cell_container_t cells;	// only non-empty cells are present
+
+	Cell_t get_cell(GU::Point p) const;
+	void remove_from_cell(const Cell_t& cell, const Visual_store_object * obj_ptr);
+	// check the objects in a cell against the best so far
+	void check_nearest(const Object_ptr_vector_t& objects, GU::Point point,
+		std::shared_ptr<Visual_store_object>& best_ptr, double& best_distance) const;
+};
+
+#endif
@@ -349,7 +349,7 @@ Symbol_list_t Visual_store::find_all (const Symbol_list_t& pv_list) const
 
 	for (Store_container_t::const_iterator obj_iter = objects.begin(); 
 			obj_iter != objects.end(); obj_iter++) {
-		shared_ptr<Visual_store_object> obj_ptr = obj_iter->second;
+		const shared_ptr<Visual_store_object>& obj_ptr = obj_iter->second;
 		
 		Symbol_list_t::const_iterator it = pv_list.begin();
 		while(it != pv_list.end()) {
@@ -23,6 +23,7 @@ Both Visual_store and Visual_store_object are base classes.
 #include "Visual_event_types.h"
 #include "Geometry.h"
 namespace GU = Geometry_Utilities;
+#include "Utility_templates.h"
 
 #include <map>
 #include <set>
@@ -141,6 +142,7 @@ public:
 	virtual void handle_event(const Visual_Change_Size_event *) {}
 	virtual void handle_event(const Visual_Change_Property_event *) {}
 	virtual void handle_event(const Visual_Erase_Property_event *) {}
+	virtual void handle_event(const Visual_Decay_event *) {}
 
 	
 	// services
@@ -155,6 +157,12 @@ public:
 	// return a list of pointers to all the current objects
 	typedef std::list<std::shared_ptr<Visual_store_object> > Store_object_ptr_list_t;
 	Store_object_ptr_list_t get_object_ptr_list() const;
+	// iterate over pointers to all the current objects, in name order, without copying them;
+	// objects must not be added or erased while the range is in use
+	typedef std::map<Symbol, std::shared_ptr<Visual_store_object> > Store_container_t;
+	typedef Map_value_range<Store_container_t> Store_object_range_t;
+	Store_object_range_t get_objects() const
+		{return Store_object_range_t(objects);}
 
 	Symbol_list_t find_all (const Symbol_list_t& pv_list) const;
 	// output a description of all of the objects currently present
@@ -163,7 +171,6 @@ public:
 protected:	
 	// state
 	bool changed;	// true if data was updated due to input.
-	typedef std::map<Symbol, std::shared_ptr<Visual_store_object> > Store_container_t;
 	Store_container_t objects;	// the object storage
 	
 	// helper functions